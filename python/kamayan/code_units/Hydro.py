@@ -9,7 +9,7 @@ from kamayan.code_units.nodes import Node
 _reconstruction = Literal["fog", "plm", "ppm", "wenoz"]
 _slope_limiter = Literal["minmod", "van_leer", "mc"]
 _recon_vars = Literal["primitive"]
-_riemann = Literal["hll", "hllc"]
+_riemann = Literal["hll", "hllc", "hlld"]
 _emf_method = Literal["arithmetic"]
 _nghost: dict[_reconstruction, int] = {"fog": 1, "plm": 2, "ppm": 3, "wenoz": 3}
 
@@ -83,6 +83,8 @@ void SetupParams(KamayanUnit *unit) {
 void InitializeData(KamayanUnit *unit) {
   // unit IS the package (StateDescriptor)
   unit->AddParam("sim_time", SimTime(), true);
+  // lets units do final stage work in the tasks they share with every stage
+  unit->AddParam("final_stage", false, true);
 }
 
 std::shared_ptr<KamayanUnit> ProcessUnit(bool with_setup) {
@@ -132,6 +134,9 @@ TaskCollection KamayanDriver::MakeTaskCollection(BlockList_t &blocks, int stage)
   const Real beta = integrator->beta[stage - 1];
   const Real dt = integrator->dt;
 
+  // the collection is executed before the next stage is built
+  pmesh->packages.Get("driver")->UpdateParam("final_stage", stage == integrator->nstages);
+
   auto partitions = pmesh->GetDefaultBlockPartitions();
   TaskRegion &single_tasklist_per_pack_region = tc.AddRegion(partitions.size());
 
@@ -176,8 +181,14 @@ TaskID KamayanDriver::BuildTaskList(TaskList &task_list, const Real &dt, const R
     next = task_list.AddTask(next, "FillDerived",
                              parthenon::Update::FillDerived<MeshData>, mbase.get());
     if (pmesh->adaptive) {
-      next = task_list.AddTask(next, "RefinementTagging",
-                               parthenon::Refinement::Tag<MeshData>, mbase.get());
+      // tagging runs before this stage's boundary exchange, as it always has, so the
+      // ghost cells the estimator & refinement buffer read are a stage old.
+      // blocks keep their tags between taggings
+      const int tag_interval = parms_->Get<int>("kamayan/refinement", "tag_interval");
+      if (tm.ncycle % tag_interval == 0) {
+        next = task_list.AddTask(next, "RefinementTagging",
+                                 parthenon::Refinement::Tag<MeshData>, mbase.get());
+      }
     }
   }
   return next;
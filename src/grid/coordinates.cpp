@@ -73,6 +73,8 @@ void CalculateCoordinates(MeshBlock *mb) {
 void CalculateCoordinates(MeshBlock *mb, Geometry geom) {
   GeometryOptions::dispatch(
       [&]<Geometry g>() {
+        // nothing to fill for analytic coordinates
+        if constexpr (CoordinatePack<g>::analytic) return;
         auto cellbounds = mb->cellbounds;
 
         auto pack = GetPack(CoordFields(), mb);
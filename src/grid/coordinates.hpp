@@ -206,42 +206,188 @@ template <Geometry geom>
 void CalculateCoordinates(const Coordinates<geom> &coords, auto &pack,
                           const parthenon::IndexShape &cellbounds);
 
+namespace impl {
+// what a CoordinatePack holds. Analytic coordinates only need the block's parthenon
+// coordinates, otherwise there is a view of each packed geom.* field
+template <Geometry geom, bool analytic>
+struct CoordinateStorage {
+  template <typename Pack>
+  KOKKOS_INLINE_FUNCTION CoordinateStorage(const Pack &pack, const int b)
+      : coords_(pack.GetCoordinates(b)) {}
+
+ protected:
+  Coordinates<geom> coords_;
+};
+
+template <Geometry geom>
+struct CoordinateStorage<geom, false> {
+  template <typename Pack>
+  KOKKOS_INLINE_FUNCTION CoordinateStorage(const Pack &, const int) {}
+
+ protected:
+  // par array type returned by SparsePack<>(b, V())
+  using par_array_t = parthenon::ParArray3D<Real, parthenon::VariableState>;
+
+  par_array_t Dx1_, Dx2_, Dx3_, X1_, X2_, X3_, Xc1_, Xc2_, Xc3_, Xf1_, Xf2_, Xf3_,
+      FaceArea1_, FaceArea2_, FaceArea3_, EdgeLength1_, EdgeLength2_, EdgeLength3_,
+      Volume_;
+
+  template <typename T>
+  requires(AxisCoords::Contains<T>())
+  KOKKOS_INLINE_FUNCTION par_array_t &Get_(const T &t) {
+    if constexpr (std::is_same_v<T, coords::Dx<Axis::KAXIS>>) {
+      return Dx1_;
+    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::JAXIS>>) {
+      return Dx2_;
+    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::IAXIS>>) {
+      return Dx3_;
+    } else if constexpr (std::is_same_v<T, coords::X<Axis::KAXIS>>) {
+      return X1_;
+    } else if constexpr (std::is_same_v<T, coords::X<Axis::JAXIS>>) {
+      return X2_;
+    } else if constexpr (std::is_same_v<T, coords::X<Axis::IAXIS>>) {
+      return X3_;
+    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::KAXIS>>) {
+      return Xc1_;
+    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::JAXIS>>) {
+      return Xc2_;
+    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::IAXIS>>) {
+      return Xc3_;
+    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::KAXIS>>) {
+      return Xf1_;
+    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::JAXIS>>) {
+      return Xf2_;
+    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::IAXIS>>) {
+      return Xf3_;
+    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::KAXIS>>) {
+      return FaceArea1_;
+    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::JAXIS>>) {
+      return FaceArea2_;
+    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::IAXIS>>) {
+      return FaceArea3_;
+    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::KAXIS>>) {
+      return EdgeLength1_;
+    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::JAXIS>>) {
+      return EdgeLength2_;
+    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::IAXIS>>) {
+      return EdgeLength3_;
+    } else {
+      static_assert(always_false<T>, "Type not mapped to a coordinate");
+    }
+  }
+  template <typename T>
+  requires(AxisCoords::Contains<T>())
+  KOKKOS_INLINE_FUNCTION const par_array_t &Get_(const T &t) const {
+    if constexpr (std::is_same_v<T, coords::Dx<Axis::KAXIS>>) {
+      return Dx1_;
+    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::JAXIS>>) {
+      return Dx2_;
+    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::IAXIS>>) {
+      return Dx3_;
+    } else if constexpr (std::is_same_v<T, coords::X<Axis::KAXIS>>) {
+      return X1_;
+    } else if constexpr (std::is_same_v<T, coords::X<Axis::JAXIS>>) {
+      return X2_;
+    } else if constexpr (std::is_same_v<T, coords::X<Axis::IAXIS>>) {
+      return X3_;
+    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::KAXIS>>) {
+      return Xc1_;
+    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::JAXIS>>) {
+      return Xc2_;
+    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::IAXIS>>) {
+      return Xc3_;
+    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::KAXIS>>) {
+      return Xf1_;
+    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::JAXIS>>) {
+      return Xf2_;
+    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::IAXIS>>) {
+      return Xf3_;
+    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::KAXIS>>) {
+      return FaceArea1_;
+    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::JAXIS>>) {
+      return FaceArea2_;
+    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::IAXIS>>) {
+      return FaceArea3_;
+    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::KAXIS>>) {
+      return EdgeLength1_;
+    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::JAXIS>>) {
+      return EdgeLength2_;
+    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::IAXIS>>) {
+      return EdgeLength3_;
+    } else {
+      static_assert(always_false<T>, "Type not mapped to a coordinate");
+    }
+  }
+
+  template <typename T>
+  requires(ScalarCoords::Contains<T>())
+  KOKKOS_INLINE_FUNCTION par_array_t &Get_(const T &t) {
+    if constexpr (std::is_same_v<T, coords::Volume>) {
+      return Volume_;
+    } else {
+      static_assert(always_false<T>, "Type not mapped to a coordinate");
+    }
+  }
+};
+}  // namespace impl
+
+// Uniform cartesian coordinates are affine in the index, so they are found from
+// the block's parthenon coordinates rather than loaded from the geom.* fields, which
+// are never allocated. Fields still lists the coordinates that are used
 template <Geometry geom, typename... Fields>
-struct CoordinatePack {
+struct CoordinatePack : impl::CoordinateStorage<geom, geom == Geometry::cartesian> {
   using FieldList = TypeList<Fields...>;
+  static constexpr bool analytic = geom == Geometry::cartesian;
+  using Storage = impl::CoordinateStorage<geom, analytic>;
+
   template <typename... Ts>
-  KOKKOS_INLINE_FUNCTION CoordinatePack(const SparsePack<Ts...> &pack, const int b) {
-    static_assert((TypeList<Ts...>::template Contains<Fields>() && ...),
-                  "Pack must contain all requested coordinate fields.");
-    (
-        [&]<typename Field>() {
-          Get_(Field()) = pack(b, Field());
-        }.template operator()<Fields>(),
-        ...);
+  KOKKOS_INLINE_FUNCTION CoordinatePack(const SparsePack<Ts...> &pack, const int b)
+      : Storage(pack, b) {
+    if constexpr (!analytic) {
+      static_assert((TypeList<Ts...>::template Contains<Fields>() && ...),
+                    "Pack must contain all requested coordinate fields.");
+      (
+          [&]<typename Field>() {
+            this->Get_(Field()) = pack(b, Field());
+          }.template operator()<Fields>(),
+          ...);
+    }
   }
 
   template <Axis ax>
   KOKKOS_INLINE_FUNCTION Real Dx(const int k, const int j, const int i) const {
     static_assert(FieldList::template Contains<coords::Dx<ax>>(),
                   "Coordinate Pack must be constructed with required Dx coordinate");
-    auto kji = Index_<coords::Dx<ax>>(k, j, i);
-    return Get_(coords::Dx<ax>())(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.template Dx<ax>();
+    } else {
+      auto kji = Index_<coords::Dx<ax>>(k, j, i);
+      return this->Get_(coords::Dx<ax>())(kji[0], kji[1], kji[2]);
+    }
   }
 
   template <Axis ax>
   KOKKOS_INLINE_FUNCTION Real X(const int k, const int j, const int i) const {
     static_assert(FieldList::template Contains<coords::X<ax>>(),
                   "Coordinate Pack must be constructed with required X coordinate");
-    auto kji = Index_<coords::X<ax>>(k, j, i);
-    return Get_(coords::X<ax>())(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.template Xi<ax>(k, j, i);
+    } else {
+      auto kji = Index_<coords::X<ax>>(k, j, i);
+      return this->Get_(coords::X<ax>())(kji[0], kji[1], kji[2]);
+    }
   }
 
   template <Axis ax>
   KOKKOS_INLINE_FUNCTION Real Xc(const int k, const int j, const int i) const {
     static_assert(FieldList::template Contains<coords::Xc<ax>>(),
                   "Coordinate Pack must be constructed with required Xc coordinate");
-    auto kji = Index_<coords::Xc<ax>>(k, j, i);
-    return Get_(coords::Xc<ax>())(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.template Xc<ax>(k, j, i);
+    } else {
+      auto kji = Index_<coords::Xc<ax>>(k, j, i);
+      return this->Get_(coords::Xc<ax>())(kji[0], kji[1], kji[2]);
+    }
   }
 
   template <Axis ax>
@@ -253,8 +399,12 @@ struct CoordinatePack {
   KOKKOS_INLINE_FUNCTION Real Xf(const int k, const int j, const int i) const {
     static_assert(FieldList::template Contains<coords::Xf<ax>>(),
                   "Coordinate Pack must be constructed with required Xf coordinate");
-    auto kji = Index_<coords::Xf<ax>>(k, j, i);
-    return Get_(coords::Xf<ax>())(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.template Xf<ax>(k, j, i);
+    } else {
+      auto kji = Index_<coords::Xf<ax>>(k, j, i);
+      return this->Get_(coords::Xf<ax>())(kji[0], kji[1], kji[2]);
+    }
   }
 
   template <Axis ax>
@@ -262,8 +412,12 @@ struct CoordinatePack {
     static_assert(
         FieldList::template Contains<coords::FaceArea<ax>>(),
         "Coordinate Pack must be constructed with required FaceArea coordinate");
-    auto kji = Index_<coords::FaceArea<ax>>(k, j, i);
-    return Get_(coords::FaceArea<ax>())(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.template FaceArea<ax>(k, j, i);
+    } else {
+      auto kji = Index_<coords::FaceArea<ax>>(k, j, i);
+      return this->Get_(coords::FaceArea<ax>())(kji[0], kji[1], kji[2]);
+    }
   }
 
   template <Axis ax>
@@ -271,15 +425,23 @@ struct CoordinatePack {
     static_assert(
         FieldList::template Contains<coords::EdgeLength<ax>>(),
         "Coordinate Pack must be constructed with required EdgeLength coordinate");
-    auto kji = Index_<coords::EdgeLength<ax>>(k, j, i);
-    return Get_(coords::EdgeLength<ax>())(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.template EdgeLength<ax>(k, j, i);
+    } else {
+      auto kji = Index_<coords::EdgeLength<ax>>(k, j, i);
+      return this->Get_(coords::EdgeLength<ax>())(kji[0], kji[1], kji[2]);
+    }
   }
 
   KOKKOS_INLINE_FUNCTION Real CellVolume(const int k, const int j, const int i) const {
     static_assert(FieldList::template Contains<coords::Volume>(),
                   "Coordinate Pack must be constructed with required Volume");
-    auto kji = Index_<coords::Volume>(k, j, i);
-    return Volume_(kji[0], kji[1], kji[2]);
+    if constexpr (analytic) {
+      return this->coords_.CellVolume(k, j, i);
+    } else {
+      auto kji = Index_<coords::Volume>(k, j, i);
+      return this->Volume_(kji[0], kji[1], kji[2]);
+    }
   }
 
   KOKKOS_INLINE_FUNCTION Real Dx(const Axis ax, const int k, const int j,
@@ -375,13 +537,6 @@ struct CoordinatePack {
   }
 
  private:
-  // par array type returned by SparsePack<>(b, V())
-  using par_array_t = parthenon::ParArray3D<Real, parthenon::VariableState>;
-
-  par_array_t Dx1_, Dx2_, Dx3_, X1_, X2_, X3_, Xc1_, Xc2_, Xc3_, Xf1_, Xf2_, Xf3_,
-      FaceArea1_, FaceArea2_, FaceArea3_, EdgeLength1_, EdgeLength2_, EdgeLength3_,
-      Volume_;
-
   template <typename Func, typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION Real AxisOverload(Func function, Axis ax,
                                                 Args &&...args) const {
@@ -414,103 +569,6 @@ struct CoordinatePack {
     }
     return {k, j, i};
   }
-
-  template <typename T>
-  requires(AxisCoords::Contains<T>())
-  KOKKOS_INLINE_FUNCTION par_array_t &Get_(const T &t) {
-    if constexpr (std::is_same_v<T, coords::Dx<Axis::KAXIS>>) {
-      return Dx1_;
-    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::JAXIS>>) {
-      return Dx2_;
-    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::IAXIS>>) {
-      return Dx3_;
-    } else if constexpr (std::is_same_v<T, coords::X<Axis::KAXIS>>) {
-      return X1_;
-    } else if constexpr (std::is_same_v<T, coords::X<Axis::JAXIS>>) {
-      return X2_;
-    } else if constexpr (std::is_same_v<T, coords::X<Axis::IAXIS>>) {
-      return X3_;
-    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::KAXIS>>) {
-      return Xc1_;
-    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::JAXIS>>) {
-      return Xc2_;
-    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::IAXIS>>) {
-      return Xc3_;
-    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::KAXIS>>) {
-      return Xf1_;
-    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::JAXIS>>) {
-      return Xf2_;
-    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::IAXIS>>) {
-      return Xf3_;
-    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::KAXIS>>) {
-      return FaceArea1_;
-    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::JAXIS>>) {
-      return FaceArea2_;
-    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::IAXIS>>) {
-      return FaceArea3_;
-    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::KAXIS>>) {
-      return EdgeLength1_;
-    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::JAXIS>>) {
-      return EdgeLength2_;
-    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::IAXIS>>) {
-      return EdgeLength3_;
-    } else {
-      static_assert(always_false<T>, "Type not mapped to a coordinate");
-    }
-  }
-  template <typename T>
-  requires(AxisCoords::Contains<T>())
-  KOKKOS_INLINE_FUNCTION const par_array_t &Get_(const T &t) const {
-    if constexpr (std::is_same_v<T, coords::Dx<Axis::KAXIS>>) {
-      return Dx1_;
-    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::JAXIS>>) {
-      return Dx2_;
-    } else if constexpr (std::is_same_v<T, coords::Dx<Axis::IAXIS>>) {
-      return Dx3_;
-    } else if constexpr (std::is_same_v<T, coords::X<Axis::KAXIS>>) {
-      return X1_;
-    } else if constexpr (std::is_same_v<T, coords::X<Axis::JAXIS>>) {
-      return X2_;
-    } else if constexpr (std::is_same_v<T, coords::X<Axis::IAXIS>>) {
-      return X3_;
-    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::KAXIS>>) {
-      return Xc1_;
-    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::JAXIS>>) {
-      return Xc2_;
-    } else if constexpr (std::is_same_v<T, coords::Xc<Axis::IAXIS>>) {
-      return Xc3_;
-    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::KAXIS>>) {
-      return Xf1_;
-    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::JAXIS>>) {
-      return Xf2_;
-    } else if constexpr (std::is_same_v<T, coords::Xf<Axis::IAXIS>>) {
-      return Xf3_;
-    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::KAXIS>>) {
-      return FaceArea1_;
-    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::JAXIS>>) {
-      return FaceArea2_;
-    } else if constexpr (std::is_same_v<T, coords::FaceArea<Axis::IAXIS>>) {
-      return FaceArea3_;
-    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::KAXIS>>) {
-      return EdgeLength1_;
-    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::JAXIS>>) {
-      return EdgeLength2_;
-    } else if constexpr (std::is_same_v<T, coords::EdgeLength<Axis::IAXIS>>) {
-      return EdgeLength3_;
-    } else {
-      static_assert(always_false<T>, "Type not mapped to a coordinate");
-    }
-  }
-
-  template <typename T>
-  requires(ScalarCoords::Contains<T>())
-  KOKKOS_INLINE_FUNCTION par_array_t &Get_(const T &t) {
-    if constexpr (std::is_same_v<T, coords::Volume>) {
-      return Volume_;
-    } else {
-      static_assert(always_false<T>, "Type not mapped to a coordinate");
-    }
-  }
 };
 
 template <Geometry geom, typename... Fields>
@@ -10,9 +10,9 @@
 #include "grid/grid_refinement.hpp"
 #include "grid/grid_types.hpp"
 #include "grid/grid_update.hpp"
-#include "grid/scratch_variables.hpp"
 #include "kamayan/runtime_parameters.hpp"
 #include "physics/hydro/hydro_types.hpp"
+#include "utils/error_checking.hpp"
 #include "utils/instrument.hpp"
 #include "utils/type_list.hpp"
 
@@ -114,11 +114,43 @@ void SetupParams(KamayanUnit *unit) {
     nref_vars += 1;
   }
 
+  // whether the user set either of these, before they get added with their defaults
+  const auto pin = rps ? rps->GetPin() : nullptr;
+  const bool votes_set = pin && pin->DoesParameterExist(ref_block, "derefine_votes");
+  const bool count_set =
+      pin && pin->DoesParameterExist("parthenon/mesh", "derefine_count");
+  parthenon_mesh.AddParm<int>("derefine_count", 10,
+                              "Number of consecutive times a block has to be tagged for "
+                              "derefinement before it is derefined. Prefer setting "
+                              "kamayan/refinement/derefine_votes.");
+  const auto derefine_count = parthenon_mesh.Get<int>("derefine_count");
+
   auto &kamayan_refinement = unit->AddData(ref_block);
   kamayan_refinement.AddParm<int>(
       "nref_vars", nref_vars,
       "Parameter determined at runtime for the number of registered refinement fields. "
       "Never any reason to be set.");
+  kamayan_refinement.AddParm<int>(
+      "tag_interval", 1, "Number of cycles between tagging blocks for refinement.");
+  kamayan_refinement.AddParm<int>(
+      "derefine_votes", derefine_count,
+      "Number of consecutive taggings that must ask to derefine a block before it is. "
+      "Defaults to follow parthenon/mesh/derefine_count.");
+  kamayan_refinement.AddParm<Real>(
+      "buffer", 0.0,
+      "Safety factor on the cells a block's fastest signal crosses between taggings, "
+      "over which neighboring cells are also checked for refinement. 0 to disable.");
+  const auto derefine_votes = kamayan_refinement.Get<int>("derefine_votes");
+  PARTHENON_REQUIRE_THROWS(derefine_votes > 0,
+                           "kamayan/refinement/derefine_votes must be positive");
+  PARTHENON_REQUIRE_THROWS(kamayan_refinement.Get<int>("tag_interval") > 0,
+                           "kamayan/refinement/tag_interval must be positive");
+  // parthenon derefines once a block has been asked to derefine_count times in a row,
+  // so the votes are only forwarded when they are set & must agree if both are
+  PARTHENON_REQUIRE_THROWS(!(votes_set && count_set) || derefine_votes == derefine_count,
+                           "kamayan/refinement/derefine_votes must equal "
+                           "parthenon/mesh/derefine_count when both are set");
+  if (votes_set) parthenon_mesh.UpdateParm("derefine_count", derefine_votes);
 }
 
 void InitializeData(KamayanUnit *unit) {
@@ -127,6 +159,7 @@ void InitializeData(KamayanUnit *unit) {
   const std::string ref_block = "kamayan/refinement";
   auto adaptive = rps->Get<std::string>("parthenon/mesh", "refinement");
   int nref_vars = 0;
+  std::vector<std::string> loehner_blocks;
   while (true && adaptive == "adaptive") {
     std::string ref_block_n = ref_block + std::to_string(nref_vars);
     if (!rps->GetPin()->DoesBlockExist(ref_block_n)) {
@@ -134,17 +167,18 @@ void InitializeData(KamayanUnit *unit) {
     }
     const auto field = rps->Get<std::string>(ref_block_n, "field");
     if (field != "NO FIELD WAS SET") {
-      // unit IS the package (StateDescriptor)
-      unit->amr_criteria.push_back(MakeAMRCriteria(rps.get(), ref_block_n));
+      if (rps->Get<std::string>(ref_block_n, "method") == "loehner") {
+        loehner_blocks.push_back(ref_block_n);
+      } else {
+        // unit IS the package (StateDescriptor)
+        unit->amr_criteria.push_back(MakeAMRCriteria(rps.get(), ref_block_n));
+      }
     }
     nref_vars += 1;
   }
-  if (nref_vars > 0) {
-    // allocate scratch needed for derivatives in loehner estimator
-    auto refinement_scratch = RefinementScratch();
-    refinement_scratch.template RegisterShape<FirstDer>({3});
-    unit->AddParam("refinement_scratch", refinement_scratch);
-    AddScratch(refinement_scratch, unit);
+  // every field refined on with loehner is evaluated in a single pass
+  if (!loehner_blocks.empty()) {
+    unit->amr_criteria.push_back(std::make_shared<AMRLoehner>(rps.get(), loehner_blocks));
   }
 
   // set the meshblock variables needed for coordinates
@@ -157,6 +191,8 @@ void InitializeData(KamayanUnit *unit) {
   const auto nghost = mesh.Get<int>("nghost");
   GeometryOptions::dispatch(
       [&]<Geometry geom>() {
+        // these are computed on the fly instead
+        if constexpr (CoordinatePack<geom>::analytic) return;
         type_for(CoordFields(), [&]<typename T>(const T) {
           // coordinate shape gives us (k,j,i) indexing, parthenon
           // internally reverses this so expects (i,j,k)
@@ -1,14 +1,17 @@
 #include "grid_refinement.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <parthenon/parthenon.hpp>
 
 #include "grid/grid.hpp"
 #include "grid/grid_types.hpp"
-#include "grid/scratch_variables.hpp"
+#include "kamayan/fields.hpp"
 
 namespace kamayan::grid {
 std::shared_ptr<parthenon::AMRCriteria>
@@ -24,128 +27,271 @@ MakeAMRCriteria(const runtime_parameters::RuntimeParameters *rps,
     // parthenon built in
     return parthenon::AMRCriteria::MakeAMRCriteria(method_str, rps->GetPin(), block_name);
   }
-  return std::make_shared<AMRLoehner>(rps, block_name);
+  return std::make_shared<AMRLoehner>(rps, std::vector<std::string>{block_name});
 }
 
-void AMRLoehner::operator()(MeshData *md,
-                            parthenon::ParArray1D<AmrTag> &delta_level) const {
-  const auto desc =
-      MakePackDescriptor(md->GetMeshPointer()->resolved_packages.get(), {field});
-  auto pack = desc.GetPack(md);
+AMRLoehner::AMRLoehner(const runtime_parameters::RuntimeParameters *rps,
+                       std::vector<std::string> block_names)
+    : AMRCriteria(rps->GetPin(), block_names.front()),
+      tag_interval_(rps->Get<int>("kamayan/refinement", "tag_interval")),
+      buffer_(rps->Get<Real>("kamayan/refinement", "buffer")) {
+  for (auto &block_name : block_names) {
+    fields_.emplace_back(rps, block_name);
+  }
+}
+
+Kokkos::View<int *> RefinementBuffer(MeshData *md, const Real buffer,
+                                     const int tag_interval, const int nbuf_max) {
+  auto mesh = md->GetMeshPointer();
+  // nothing moves without a driver to step it
+  if (mesh->packages.AllPackages().count("driver") == 0) {
+    return Kokkos::View<int *>("refinement_buffer", md->NumBlocks());
+  }
+  const Real dt = mesh->packages.Get("driver")->Param<SimTime>("sim_time").dt;
+  return RefinementBuffer(md, mesh->resolved_packages.get(), mesh->ndim, dt, buffer,
+                          tag_interval, nbuf_max);
+}
+
+Kokkos::View<int *> RefinementBuffer(MeshData *md, StateDescriptor *pkg, const int ndim,
+                                     const Real dt, const Real buffer,
+                                     const int tag_interval, const int nbuf_max) {
+  const int nblocks = md->NumBlocks();
+  Kokkos::View<int *> nbuf("refinement_buffer", nblocks);
+  // nothing moves without a velocity
+  if (buffer <= 0.0 || nbuf_max <= 0 || !pkg->FieldPresent(VELOCITY::name())) {
+    return nbuf;
+  }
 
-  auto refinement_scratch =
-      md->GetMeshPointer()->packages.Get("grid")->Param<RefinementScratch>(
-          "refinement_scratch");
-  const auto pack_der = ScratchPack(md, refinement_scratch);
+  // the fast speeds are only there when the hydro caches them
+  const bool cached_speeds = pkg->FieldPresent(CFAST::name());
+  // and only have a component in each direction with mhd
+  const bool directional_speeds =
+      cached_speeds && pkg->FieldMetadata(CFAST::name()).Shape()[0] > 1;
+  std::vector<std::string> names{VELOCITY::name()};
+  if (cached_speeds) names.push_back(CFAST::name());
+  const auto desc = MakePackDescriptor(pkg, names);
+  auto pack = desc.GetPack(md);
+  auto map = desc.GetMap();
+  const int vel_idx = map[VELOCITY::name()];
+  const int cfast_idx = cached_speeds ? map[CFAST::name()] : -1;
 
-  const int ndim = md->GetMeshPointer()->ndim;
   auto ib = md->GetBoundsI(IndexDomain::interior);
   auto jb = md->GetBoundsJ(IndexDomain::interior);
   auto kb = md->GetBoundsK(IndexDomain::interior);
 
-  // this was just copied from
-  auto dims = md->GetMeshPointer()->resolved_packages->FieldMetadata(field).Shape();
-  const int k2d = ndim > 1 ? 1 : 0;
-  const int k3d = ndim > 2 ? 1 : 0;
-  int n5(0), n4(0);
-  if (dims.size() > 2) {
-    n5 = dims[1];
-    n4 = dims[2];
-  } else if (dims.size() > 1) {
-    n5 = dims[0];
-    n4 = dims[1];
-  }
-  const int var = comp4 + n4 * (comp5 + n5 * comp6);
-
-  // calculate derivatives
+  // fastest rate in cells per unit time of each block
+  Kokkos::View<Real *> rate("signal_rate", nblocks);
   parthenon::par_for(
-      PARTHENON_AUTO_LABEL, 0, pack.GetNBlocks() - 1, kb.s - k3d, kb.e + k3d, jb.s - k2d,
-      jb.e + k2d, ib.s - 1, ib.e + 1,
+      PARTHENON_AUTO_LABEL, 0, pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
       KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
-        // TODO(acreyes): this could be updated to be templated on geometry, but
-        // would only matter for something more than 2D rz cylindrical to be different
         const auto coords = pack.GetCoordinates(b);
-        using TE = TopologicalElement;
-        // --8<-- [start:FirstDer]
-        pack_der(b, 0, k, j, i) =
-            0.5 * (pack(b, var, k, j, i + 1) - pack(b, var, k, j, i - 1)) /
-            coords.Dxc<1>();
-        // --8<-- [end:FirstDer]
-
-        if (ndim > 1)
-          pack_der(b, 1, k, j, i) =
-              0.5 * (pack(b, var, k, j + 1, i) - pack(b, var, k, j - 1, i)) /
-              coords.Dxc<2>();
-
-        if (ndim > 2)
-          pack_der(b, 2, k, j, i) =
-              0.5 * (pack(b, var, k + 1, j, i) - pack(b, var, k - 1, j, i)) /
-              coords.Dxc<3>();
+        const int vel = pack.GetLowerBound(b, parthenon::PackIdx(vel_idx));
+        Real cell_rate = 0.0;
+        for (int d = 0; d < ndim; d++) {
+          Real speed = Kokkos::abs(pack(b, vel + d, k, j, i));
+          if (cached_speeds) {
+            // without mhd there is a single isotropic fast speed
+            const int cfast = pack.GetLowerBound(b, parthenon::PackIdx(cfast_idx));
+            speed += pack(b, cfast + (directional_speeds ? d : 0), k, j, i);
+          }
+          cell_rate = Kokkos::max(cell_rate, speed / coords.Dx(d + 1));
+        }
+        Kokkos::atomic_max(&rate(b), cell_rate);
+      });
+
+  parthenon::par_for(
+      PARTHENON_AUTO_LABEL, 0, nblocks - 1, KOKKOS_LAMBDA(const int b) {
+        const Real ncells = Kokkos::ceil(buffer * rate(b) * dt * tag_interval);
+        nbuf(b) = Kokkos::min(static_cast<Real>(nbuf_max), ncells);
       });
+  return nbuf;
+}
+
+namespace impl {
+// what the refinement kernel needs to know about each field
+struct LoehnerParams {
+  int pack_idx, comp;
+  Real refine_tol, derefine_tol, filter;
+  int max_level;
+};
+
+// the error in a buffer cell needs the field two cells further out
+int MaxRefinementBuffer() { return parthenon::Globals::nghost - 2; }
+}  // namespace impl
+
+void AMRLoehner::operator()(MeshData *md,
+                            parthenon::ParArray1D<AmrTag> &delta_level) const {
+  std::vector<std::string> filled;
+  for (const auto &f : fields_) {
+    if (std::find(filled.begin(), filled.end(), f.field) != filled.end()) continue;
+    KamayanUnit::FillLazyDerived(md, f.field);
+    filled.push_back(f.field);
+  }
+
+  auto mesh = md->GetMeshPointer();
+  auto nbuf = RefinementBuffer(md, buffer_, tag_interval_, impl::MaxRefinementBuffer());
+  Tag(md, mesh->resolved_packages.get(), mesh->ndim, nbuf, delta_level);
+}
+
+void AMRLoehner::Tag(MeshData *md, StateDescriptor *pkg, const int ndim,
+                     const Kokkos::View<int *> &nbuf,
+                     parthenon::ParArray1D<AmrTag> &delta_level) const {
+  std::vector<std::string> names;
+  for (const auto &f : fields_) {
+    if (std::find(names.begin(), names.end(), f.field) != names.end()) continue;
+    names.push_back(f.field);
+  }
+  const auto desc = MakePackDescriptor(pkg, names);
+  auto pack = desc.GetPack(md);
+  auto map = desc.GetMap();
+
+  const int nfields = fields_.size();
+  Kokkos::View<impl::LoehnerParams *> params("loehner_params", nfields);
+  auto params_h = Kokkos::create_mirror_view(params);
+  for (int n = 0; n < nfields; n++) {
+    const auto &f = fields_[n];
+    // flattened component of the field, as parthenon's own criteria find it
+    auto dims = pkg->FieldMetadata(f.field).Shape();
+    int n5(0), n4(0);
+    if (dims.size() > 2) {
+      n5 = dims[1];
+      n4 = dims[2];
+    } else if (dims.size() > 1) {
+      n5 = dims[0];
+      n4 = dims[1];
+    }
+    params_h(n) = {map[f.field],      f.comp4 + n4 * (f.comp5 + n5 * f.comp6),
+                   f.refine_criteria, f.derefine_criteria,
+                   f.filter,          f.max_level};
+  }
+  Kokkos::deep_copy(params, params_h);
+
+  auto ib = md->GetBoundsI(IndexDomain::interior);
+  auto jb = md->GetBoundsJ(IndexDomain::interior);
+  auto kb = md->GetBoundsK(IndexDomain::interior);
+
+  const int nbuf_max = impl::MaxRefinementBuffer();
+  const int ext_j = ndim > 1 ? nbuf_max : 0;
+  const int ext_k = ndim > 2 ? nbuf_max : 0;
+
+  // the first derivatives of the row (k, j) and of its neighbors along j & k are
+  // found in team scratch, in the order
+  //   (k, j), (k, j - 1), (k, j + 1), (k - 1, j), (k + 1, j)
+  constexpr int nrows = 5;
+  const int nrows_used = 2 * ndim - 1;
+  const int nx = ib.e - ib.s + 3 + 2 * nbuf_max;
+  const int i0 = ib.s - nbuf_max - 1;
+  const int scratch_level = 1;
+  const std::size_t scratch_size_in_bytes = ScratchPad3D::shmem_size(nrows, 3, nx);
 
   auto scatter_tags = delta_level.ToScatterView<Kokkos::Experimental::ScatterMax>();
   parthenon::par_for_outer(
-      PARTHENON_AUTO_LABEL, 0, 0, 0, pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e,
-      KOKKOS_CLASS_LAMBDA(parthenon::team_mbr_t team_member, const int b, const int k,
-                          const int j) {
+      PARTHENON_AUTO_LABEL, scratch_size_in_bytes, scratch_level, 0,
+      pack.GetNBlocks() - 1, kb.s - ext_k, kb.e + ext_k, jb.s - ext_j, jb.e + ext_j,
+      KOKKOS_LAMBDA(parthenon::team_mbr_t team_member, const int b, const int k,
+                    const int j) {
+        const int nb = nbuf(b);
+        if (k < kb.s - nb || k > kb.e + nb || j < jb.s - nb || j > jb.e + nb) return;
+        const int is = ib.s - nb;
+        const int ie = ib.e + nb;
+        // TODO(acreyes): this could be updated to be templated on geometry, but
+        // would only matter for something more than 2D rz cylindrical to be different
         const auto coords = pack.GetCoordinates(b);
-        Real max_err_2 = 0.;
-        parthenon::par_reduce_inner(
-            parthenon::inner_loop_pattern_ttr_tag, team_member, ib.s, ib.e,
-            [&](const int i, Real &loc_max_err_2) {
-              // numerator = sum ( d2u_dpdq * dxpdxq )^2
-              // denominator = sum [ dxp*(d|u|_dp_q+ + d|u|_dp_q-)
-              //                    +eps*d2|u|_dpdq * dxpdxq]^2
-              using TE = TopologicalElement;
-              Real numerator = 0.0;
-              Real denominator = 1.e-12;
-              for (int q = 0; q < ndim; q++) {
-                auto fq = static_cast<TE>(q + static_cast<int>(TE::F1));
-                Kokkos::Array<int, 3> kji_q{(fq == TE::F3), (fq == TE::F2),
-                                            (fq == TE::F1)};
-                for (int p = 0; p < ndim; p++) {
-                  auto fp = static_cast<TE>(p + static_cast<int>(TE::F1));
-                  Kokkos::Array<int, 3> kji_p{(fp == TE::F3), (fp == TE::F2),
-                                              (fp == TE::F1)};
-
-                  const Real num =
-                      0.5 *
-                      (pack_der(b, p, k + kji_q[0], j + kji_q[1], i + kji_q[2]) -
-                       pack_der(b, p, k - kji_q[0], j - kji_q[1], i - kji_q[2])) /
-                      coords.Dx(q + 1);
-                  numerator += std::pow(num, 2);
-
-                  const Real denom =
-                      0.5 *
-                          (std::abs(
-                               pack_der(b, p, k + kji_q[0], j + kji_q[1], i + kji_q[2])) +
-                           std::abs(pack_der(b, p, k - kji_q[0], j - kji_q[1],
-                                             i - kji_q[2]))) /
-                          coords.Dx(p + 1) +
-                      filter *
-                          (std::abs(
-                               pack(b, var, k + kji_q[0], j + kji_q[1], i + kji_q[2])) +
-                           std::abs(
-                               pack(b, var, k - kji_q[0], j - kji_q[1], i - kji_q[2])) +
-                           std::abs(
-                               pack(b, var, k - kji_p[0], j - kji_p[1], i - kji_p[2])) +
-                           std::abs(
-                               pack(b, var, k + kji_p[0], j + kji_p[1], i + kji_p[2]))) /
-                          (coords.Dx(q + 1) * coords.Dx(p + 1));
-                  denominator += std::pow(denom, 2);
+        const Kokkos::Array<int, nrows> row_k{0, 0, 0, -1, 1};
+        const Kokkos::Array<int, nrows> row_j{0, -1, 1, 0, 0};
+        // der(row, p, i - i0) holds d u / d x_p
+        ScratchPad3D der(team_member.team_scratch(scratch_level), nrows, 3, nx);
+        const int level = pack.GetLevel(b, 0, 0, 0);
+
+        auto flag = AmrTag::derefine;
+        for (int n = 0; n < nfields; n++) {
+          const auto field = params(n);
+          const int var =
+              pack.GetLowerBound(b, parthenon::PackIdx(field.pack_idx)) + field.comp;
+          // the previous field's derivatives need to be used up
+          if (n > 0) team_member.team_barrier();
+          parthenon::par_for_inner(
+              team_member, 0, nrows_used - 1, is - 1, ie + 1,
+              [&](const int row, const int i) {
+                const int kk = k + row_k[row];
+                const int jj = j + row_j[row];
+                der(row, 0, i - i0) =
+                    0.5 * (pack(b, var, kk, jj, i + 1) - pack(b, var, kk, jj, i - 1)) /
+                    coords.Dxc<1>();
+
+                if (ndim > 1)
+                  der(row, 1, i - i0) =
+                      0.5 * (pack(b, var, kk, jj + 1, i) - pack(b, var, kk, jj - 1, i)) /
+                      coords.Dxc<2>();
+
+                if (ndim > 2)
+                  der(row, 2, i - i0) =
+                      0.5 * (pack(b, var, kk + 1, jj, i) - pack(b, var, kk - 1, jj, i)) /
+                      coords.Dxc<3>();
+              });
+          team_member.team_barrier();
+
+          Real max_err_2 = 0.;
+          parthenon::par_reduce_inner(
+              parthenon::inner_loop_pattern_ttr_tag, team_member, is, ie,
+              [&](const int i, Real &loc_max_err_2) {
+                // numerator = sum ( d2u_dpdq * dxpdxq )^2
+                // denominator = sum [ dxp*(d|u|_dp_q+ + d|u|_dp_q-)
+                //                    +eps*d2|u|_dpdq * dxpdxq]^2
+                using TE = TopologicalElement;
+                Real numerator = 0.0;
+                Real denominator = 1.e-12;
+                for (int q = 0; q < ndim; q++) {
+                  auto fq = static_cast<TE>(q + static_cast<int>(TE::F1));
+                  Kokkos::Array<int, 3> kji_q{(fq == TE::F3), (fq == TE::F2),
+                                              (fq == TE::F1)};
+                  // derivatives at the neighbors on either side along q
+                  const int row_p = q == 0 ? 0 : 2 * q;
+                  const int row_m = q == 0 ? 0 : 2 * q - 1;
+                  const int ip = i - i0 + kji_q[2];
+                  const int im = i - i0 - kji_q[2];
+                  for (int p = 0; p < ndim; p++) {
+                    auto fp = static_cast<TE>(p + static_cast<int>(TE::F1));
+                    Kokkos::Array<int, 3> kji_p{(fp == TE::F3), (fp == TE::F2),
+                                                (fp == TE::F1)};
+
+                    const Real num =
+                        0.5 * (der(row_p, p, ip) - der(row_m, p, im)) / coords.Dx(q + 1);
+                    numerator += std::pow(num, 2);
+
+                    const Real denom =
+                        0.5 *
+                            (std::abs(der(row_p, p, ip)) + std::abs(der(row_m, p, im))) /
+                            coords.Dx(p + 1) +
+                        field.filter *
+                            (std::abs(pack(b, var, k + kji_q[0], j + kji_q[1],
+                                           i + kji_q[2])) +
+                             std::abs(pack(b, var, k - kji_q[0], j - kji_q[1],
+                                           i - kji_q[2])) +
+                             std::abs(pack(b, var, k - kji_p[0], j - kji_p[1],
+                                           i - kji_p[2])) +
+                             std::abs(pack(b, var, k + kji_p[0], j + kji_p[1],
+                                           i + kji_p[2]))) /
+                            (coords.Dx(q + 1) * coords.Dx(p + 1));
+                    denominator += std::pow(denom, 2);
+                  }
                 }
-              }
-              loc_max_err_2 = denominator == 0.0
-                                  ? loc_max_err_2
-                                  : Kokkos::max(loc_max_err_2, numerator / denominator);
-            },
-            Kokkos::Max<Real>(max_err_2));
+                loc_max_err_2 = denominator == 0.0
+                                    ? loc_max_err_2
+                                    : Kokkos::max(loc_max_err_2, numerator / denominator);
+              },
+              Kokkos::Max<Real>(max_err_2));
+
+          const Real max_err = Kokkos::sqrt(max_err_2);
+          auto field_flag = AmrTag::same;
+          if (max_err > field.refine_tol && level < field.max_level)
+            field_flag = AmrTag::refine;
+          if (max_err < field.derefine_tol) field_flag = AmrTag::derefine;
+          // any field asking for refinement wins, and all must agree to derefine
+          if (static_cast<int>(field_flag) > static_cast<int>(flag)) flag = field_flag;
+        }
+
         auto tags_access = scatter_tags.access();
-        auto flag = AmrTag::same;
-        const Real max_err = Kokkos::sqrt(max_err_2);
-        if (max_err > refine_criteria && pack.GetLevel(b, 0, 0, 0) < max_level)
-          flag = AmrTag::refine;
-        if (max_err < derefine_criteria) flag = AmrTag::derefine;
         tags_access(b).update(flag);
       });
   delta_level.ContributeScatter(scatter_tags);
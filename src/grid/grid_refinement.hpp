@@ -2,12 +2,13 @@
 #define GRID_GRID_REFINEMENT_HPP_
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <Kokkos_Core.hpp>
 #include <amr_criteria/amr_criteria.hpp>
 
 #include "dispatcher/options.hpp"
 #include "grid/grid_types.hpp"
-#include "grid/scratch_variables.hpp"
 #include "kamayan/runtime_parameters.hpp"
 
 namespace kamayan {
@@ -17,25 +18,53 @@ POLYMORPHIC_PARM(RefinementCriteria, loehner, first, second);
 namespace kamayan::grid {
 using AmrTag = parthenon::AmrTag;
 
-// --8<-- [start:scratch]
-// first-order derivative at centers used in Loehner estimator
-using FirstDer = RuntimeScratchVariable<"firstder", TopologicalType::Cell, 3>;
-
-using RefinementScratch = RuntimeScratchVariableList<FirstDer>;
-// --8<-- [end:scratch]
-
 std::shared_ptr<parthenon::AMRCriteria>
 MakeAMRCriteria(const runtime_parameters::RuntimeParameters *rps, std::string block_name);
 
-struct AMRLoehner : public parthenon::AMRCriteria {
-  AMRLoehner(const runtime_parameters::RuntimeParameters *rps, std::string &block_name)
+// settings of a single <kamayan/refinementN> block using the Loehner estimator,
+// which is evaluated along with the others by AMRLoehner
+struct LoehnerField : public parthenon::AMRCriteria {
+  LoehnerField(const runtime_parameters::RuntimeParameters *rps, std::string &block_name)
       : AMRCriteria(rps->GetPin(), block_name),
         filter(rps->Get<Real>(block_name, "filter")) {}
+  void operator()(MeshData *md,
+                  parthenon::ParArray1D<AmrTag> &delta_level) const override {}
+
+  Real filter;
+};
+
+// Loehner's estimator over every field in block_names in a single pass over the mesh.
+// Each field has its own thresholds & max_level, and a block is tagged with the
+// strongest of the fields' tags.
+// Blocks are only tagged every kamayan/refinement/tag_interval cycles, so the
+// estimator is also evaluated over a buffer of the neighbors' cells just outside
+// each block, as wide as its fastest signal can travel until the next tagging
+struct AMRLoehner : public parthenon::AMRCriteria {
+  AMRLoehner(const runtime_parameters::RuntimeParameters *rps,
+             std::vector<std::string> block_names);
   void operator()(MeshData *md,
                   parthenon::ParArray1D<AmrTag> &delta_level) const override;
+  // tags each block of md with the fields found in pkg, also checking the nbuf cells
+  // just outside of each block
+  void Tag(MeshData *md, StateDescriptor *pkg, const int ndim,
+           const Kokkos::View<int *> &nbuf,
+           parthenon::ParArray1D<AmrTag> &delta_level) const;
 
  private:
-  Real filter;
+  std::vector<LoehnerField> fields_;
+  int tag_interval_;
+  Real buffer_;
 };
+
+// cells a signal can cross in each block over tag_interval cycles, scaled by
+// buffer and capped at nbuf_max. Blocks are tagged before the final stage's boundary
+// exchange, so the VELOCITY & CFAST read in the ghost cells are a stage behind
+Kokkos::View<int *> RefinementBuffer(MeshData *md, const Real buffer,
+                                     const int tag_interval, const int nbuf_max);
+// same as above for cycles of length dt, with the VELOCITY & cached CFAST fields
+// found in pkg rather than the mesh's resolved packages
+Kokkos::View<int *> RefinementBuffer(MeshData *md, StateDescriptor *pkg, const int ndim,
+                                     const Real dt, const Real buffer,
+                                     const int tag_interval, const int nbuf_max);
 }  // namespace kamayan::grid
 #endif  // GRID_GRID_REFINEMENT_HPP_
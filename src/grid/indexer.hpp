@@ -5,6 +5,7 @@
 
 #include "grid/grid_types.hpp"
 #include "grid/subpack.hpp"
+#include "kamayan_utils/simd.hpp"
 #include "kamayan_utils/type_list_array.hpp"
 
 namespace kamayan {
@@ -104,8 +105,9 @@ struct ScratchIndexer {
                  const int &i_)
       : pack(pack_), scratch(scratch_), b(b_), i(i_) {}
 
+  // Real, or float for single precision scratch
   template <typename V>
-  KOKKOS_INLINE_FUNCTION Real &operator()(const V &var) const {
+  KOKKOS_INLINE_FUNCTION auto &operator()(const V &var) const {
     return scratch(pack.GetIndex(b, var), i);
   }
 
@@ -115,6 +117,49 @@ struct ScratchIndexer {
   const int i, b;
 };
 
+// simd batch version of the ScratchIndexer, loading simd_width contiguous
+// cells starting at i
+template <typename ScratchPad, typename... Ts>
+struct SimdScratchIndexer {
+  KOKKOS_INLINE_FUNCTION
+  SimdScratchIndexer(const SparsePack<Ts...> &pack_, ScratchPad scratch_, const int &b_,
+                     const int &i_)
+      : pack(pack_), scratch(scratch_), b(b_), i(i_) {}
+
+  template <typename V>
+  KOKKOS_INLINE_FUNCTION SimdReal operator()(const V &var) const {
+    return SimdLoad(&scratch(pack.GetIndex(b, var), i));
+  }
+
+ private:
+  const SparsePack<Ts...> &pack;
+  ScratchPad scratch;
+  const int i, b;
+};
+
+// writes fluxes on a simd batch of faces starting at i
+template <typename... Ts>
+struct SimdFluxIndexer {
+  KOKKOS_INLINE_FUNCTION
+  SimdFluxIndexer(const SparsePack<Ts...> &pack_, const int &b_, const int &k_,
+                  const int &j_, const int &i_)
+      : pack(pack_), b(b_), k(k_), j(j_), i(i_) {}
+
+  template <typename V>
+  KOKKOS_INLINE_FUNCTION SimdRef flux(const TopologicalElement &te, const V &var) const {
+    return SimdRef(&pack.flux(b, te, var, k, j, i));
+  }
+
+  template <typename V>
+  KOKKOS_INLINE_FUNCTION std::size_t GetSize(const V &var) const {
+    return pack.GetSize(b, var);
+  }
+
+ private:
+  const SparsePack<Ts...> &pack;
+  const int b, k, j, i;
+};
+
 template <Axis axis, template <typename...> typename Container, typename... Ts>
 requires(PackLike<Container, Ts...>)
 struct SparsePackStencil1D {
@@ -137,6 +182,26 @@ struct SparsePackStencil1D {
   const int b, var, k, j, i;
 };
 
+// 1D stencil into a (var, j, i) tile of cells held in scratch
+template <Axis axis, typename ScratchPad>
+requires(axis != Axis::KAXIS)
+struct ScratchStencil1D {
+  KOKKOS_INLINE_FUNCTION
+  ScratchStencil1D(ScratchPad scratch_, const int &var_, const int &j_, const int &i_)
+      : scratch(scratch_), var(var_), j(j_), i(i_) {}
+
+  KOKKOS_INLINE_FUNCTION Real &operator()(const int &idx) {
+    if constexpr (axis == Axis::JAXIS) {
+      return scratch(var, j + idx, i);
+    }
+    return scratch(var, j, i + idx);
+  }
+
+ private:
+  ScratchPad scratch;
+  const int var, j, i;
+};
+
 template <Axis axis1, Axis axis2, template <typename...> typename Container,
           typename... Ts>
 requires(PackLike<Container, Ts...>)
@@ -209,6 +274,12 @@ KOKKOS_INLINE_FUNCTION auto MakePackStencil2D(const Container<Ts...> &pack, cons
   return SparsePackStencil2D<axis1, axis2, Container, Ts...>(pack, b, var, k, j, i);
 }
 
+template <Axis axis, typename ScratchPad>
+KOKKOS_INLINE_FUNCTION auto MakeScratchStencil1D(ScratchPad &scratch, const int &var,
+                                                 const int &j, const int &i) {
+  return ScratchStencil1D<axis, ScratchPad>(scratch, var, j, i);
+}
+
 // index into scratch pad with the same types as sparse pack
 template <typename ScratchPad, DenseVar... Ts>
 KOKKOS_INLINE_FUNCTION auto MakeScratchIndexer(const SparsePack<Ts...> &pack,
@@ -216,6 +287,20 @@ KOKKOS_INLINE_FUNCTION auto MakeScratchIndexer(const SparsePack<Ts...> &pack,
                                                const int &i) {
   return ScratchIndexer<ScratchPad, Ts...>(pack, scratch, b, i);
 }
+
+template <typename ScratchPad, DenseVar... Ts>
+KOKKOS_INLINE_FUNCTION auto MakeSimdScratchIndexer(const SparsePack<Ts...> &pack,
+                                                   ScratchPad &scratch, const int &b,
+                                                   const int &i) {
+  return SimdScratchIndexer<ScratchPad, Ts...>(pack, scratch, b, i);
+}
+
+template <typename... Ts>
+KOKKOS_INLINE_FUNCTION auto MakeSimdFluxIndexer(const SparsePack<Ts...> &pack,
+                                                const int &b, const int &k, const int &j,
+                                                const int &i) {
+  return SimdFluxIndexer<Ts...>(pack, b, k, j, i);
+}
 }  // namespace kamayan
 
 #endif  // GRID_INDEXER_HPP_
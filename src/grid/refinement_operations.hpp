@@ -24,8 +24,7 @@ namespace util {
 template <int DIM, TopologicalElement EL, Geometry geom>
 KOKKOS_FORCEINLINE_FUNCTION void
 GetGridSpacings(const Coordinates<geom> &coords, const Coordinates<geom> &coarse_coords,
-                const parthenon::IndexRange &cib, const parthenon::IndexRange &ib, int i,
-                int fi, Real *dxm, Real *dxp, Real *dxfm, Real *dxfp) {
+                int i, int fi, Real *dxm, Real *dxp, Real *dxfm, Real *dxfp) {
   // here "f" signifies the fine grid, not face locations.
   constexpr auto ax = AxisFromInt(DIM);
   const Real xm = coarse_coords.template X<ax, EL>(i - 1);
@@ -39,6 +38,177 @@ GetGridSpacings(const Coordinates<geom> &coords, const Coordinates<geom> &coarse
   *dxfp = fxp - xc;
 }
 
+// whether an element spans both fine elements along each axis of a coarse one
+template <int DIM, TopologicalElement el>
+struct RefinedAxes {
+  using TE = TopologicalElement;
+  static constexpr bool X1 =
+      (DIM > 0) && (el == TE::CC || el == TE::F2 || el == TE::F3 || el == TE::E1);
+  static constexpr bool X2 =
+      (DIM > 1) && (el == TE::CC || el == TE::F3 || el == TE::F1 || el == TE::E2);
+  static constexpr bool X3 =
+      (DIM > 2) && (el == TE::CC || el == TE::F1 || el == TE::F2 || el == TE::E3);
+};
+
+// The geometric weights of the refinement operations only depend on the coarse
+// element & the fine elements it covers, so they are found once here for every
+// variable rather than inside of each variable's stencil.
+//
+// Restriction averages the fine elements weighted by their volumes
+template <Geometry geom, int DIM, TopologicalElement el>
+struct RestrictionWeights {
+  KOKKOS_FORCEINLINE_FUNCTION RestrictionWeights(const parthenon::Coordinates_t &pcoords,
+                                                 const int k, const int j, const int i) {
+    using axes = RefinedAxes<DIM, el>;
+    auto coords = Coordinates<geom>(pcoords);
+    // JMM: If dimensionality is wrong, accesses are out of bounds. Only
+    // access cells if dimensionality is correct.
+    for (int ok = 0; ok < 2; ++ok) {
+      for (int oj = 0; oj < 2; ++oj) {
+        for (int oi = 0; oi < 2; ++oi) {
+          vol_[ok][oj][oi] = 0;
+        }
+      }
+    }
+    for (int ok = 0; ok < 1 + axes::X3; ++ok) {
+      for (int oj = 0; oj < 1 + axes::X2; ++oj) {
+        for (int oi = 0; oi < 1 + axes::X1; ++oi) {
+          vol_[ok][oj][oi] = coords.template Volume<el>(k + ok, j + oj, i + oi);
+        }
+      }
+    }
+    // KGF: add the off-centered quantities first to preserve FP
+    // symmetry
+    const Real tvol =
+        ((vol_[0][0][0] + vol_[0][1][0]) + (vol_[0][0][1] + vol_[0][1][1])) +
+        ((vol_[1][0][0] + vol_[1][1][0]) + (vol_[1][0][1] + vol_[1][1][1]));
+    inv_tvol_ = tvol > 0.0 ? 1.0 / tvol : 0.0;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION Real Volume(const int ok, const int oj,
+                                          const int oi) const {
+    return vol_[ok][oj][oi];
+  }
+  KOKKOS_FORCEINLINE_FUNCTION Real InverseTotal() const { return inv_tvol_; }
+
+ private:
+  Real vol_[2][2][2];  // memset not available on all accelerators
+  Real inv_tvol_;
+};
+
+// every fine element of a uniform cartesian mesh has the same volume
+template <int DIM, TopologicalElement el>
+struct RestrictionWeights<Geometry::cartesian, DIM, el> {
+  using axes = RefinedAxes<DIM, el>;
+  KOKKOS_FORCEINLINE_FUNCTION RestrictionWeights(const parthenon::Coordinates_t &,
+                                                 const int, const int, const int) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real Volume(const int ok, const int oj,
+                                                           const int oi) {
+    return (ok <= axes::X3 && oj <= axes::X2 && oi <= axes::X1) ? 1.0 : 0.0;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real InverseTotal() {
+    return 1.0 / ((1 + axes::X1) * (1 + axes::X2) * (1 + axes::X3));
+  }
+};
+
+// Prolongation needs the distances from the coarse centroid to its neighbors, dxm
+// & dxp, and to the fine centroids, dxfm & dxfp, along each axis. Fields on the
+// r-faces of cylindrical meshes are prolongated as r * u, so those radii are kept too
+template <Geometry geom, int DIM, TopologicalElement el>
+struct ProlongationWeights {
+  static constexpr bool SCALE_BY_R = (geom == Geometry::cylindrical) &&
+                                     (el == TopologicalElement::F1 ||
+                                      el == TopologicalElement::F2);
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ProlongationWeights(const parthenon::Coordinates_t &pcoords,
+                      const parthenon::Coordinates_t &pcoarse_coords, const int k,
+                      const int j, const int i, const int fk, const int fj,
+                      const int fi) {
+    using axes = RefinedAxes<DIM, el>;
+    auto coords = Coordinates<geom>(pcoords);
+    auto coarse_coords = Coordinates<geom>(pcoarse_coords);
+    for (int d = 0; d < 3; d++) {
+      dxm_[d] = dxp_[d] = 1.0;
+      dxfm_[d] = dxfp_[d] = 0.0;
+    }
+    if constexpr (axes::X1) Spacings<1>(coords, coarse_coords, i, fi);
+    if constexpr (axes::X2) Spacings<2>(coords, coarse_coords, j, fj);
+    if constexpr (axes::X3) Spacings<3>(coords, coarse_coords, k, fk);
+
+    if constexpr (SCALE_BY_R) {
+      for (int o = 0; o < 3; o++) {
+        r_coarse_[o] = coarse_coords.template Xf<el, Axis::IAXIS>(i - 1 + o);
+      }
+      for (int o = 0; o < 2; o++) {
+        inv_r_fine_[o] = 1.0 / (coords.template Xf<el, Axis::IAXIS>(fi + o) +
+                                std::numeric_limits<Real>::epsilon());
+      }
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION Real dxm(const int d) const { return dxm_[d]; }
+  KOKKOS_FORCEINLINE_FUNCTION Real dxp(const int d) const { return dxp_[d]; }
+  KOKKOS_FORCEINLINE_FUNCTION Real dxfm(const int d) const { return dxfm_[d]; }
+  KOKKOS_FORCEINLINE_FUNCTION Real dxfp(const int d) const { return dxfp_[d]; }
+
+  // scale of the coarse element offset by oi in [-1, 1] along r
+  KOKKOS_FORCEINLINE_FUNCTION Real CoarseScale(const int oi) const {
+    if constexpr (SCALE_BY_R) return r_coarse_[oi + 1];
+    return 1.0;
+  }
+  // scale of the fine element offset by oi in [0, 1] along r
+  KOKKOS_FORCEINLINE_FUNCTION Real InverseFineScale(const int oi) const {
+    if constexpr (SCALE_BY_R) return inv_r_fine_[oi];
+    return 1.0;
+  }
+
+ private:
+  template <int DIR>
+  KOKKOS_FORCEINLINE_FUNCTION void Spacings(const Coordinates<geom> &coords,
+                                            const Coordinates<geom> &coarse_coords,
+                                            const int idx, const int fidx) {
+    GetGridSpacings<DIR, el, geom>(coords, coarse_coords, idx, fidx, &dxm_[DIR - 1],
+                                   &dxp_[DIR - 1], &dxfm_[DIR - 1], &dxfp_[DIR - 1]);
+  }
+
+  Real dxm_[3], dxp_[3], dxfm_[3], dxfp_[3];
+  Real r_coarse_[SCALE_BY_R ? 3 : 1];
+  Real inv_r_fine_[SCALE_BY_R ? 2 : 1];
+};
+
+// on a uniform cartesian mesh the fine centroids are always a quarter of the coarse
+// spacing away, which the slopes are found in units of
+template <int DIM, TopologicalElement el>
+struct ProlongationWeights<Geometry::cartesian, DIM, el> {
+  using axes = RefinedAxes<DIM, el>;
+  static constexpr bool SCALE_BY_R = false;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ProlongationWeights(const parthenon::Coordinates_t &, const parthenon::Coordinates_t &,
+                      const int, const int, const int, const int, const int, const int) {
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real dxm(const int) { return 1.0; }
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real dxp(const int) { return 1.0; }
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real dxfm(const int d) {
+    return Refined(d) ? 0.25 : 0.0;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real dxfp(const int d) {
+    return Refined(d) ? 0.25 : 0.0;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real CoarseScale(const int) { return 1.0; }
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr Real InverseFineScale(const int) {
+    return 1.0;
+  }
+
+ private:
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr bool Refined(const int d) {
+    return d == 0 ? axes::X1 : (d == 1 ? axes::X2 : axes::X3);
+  }
+};
+
 KOKKOS_FORCEINLINE_FUNCTION
 Real GradMinMod(const Real fc, const Real fm, const Real fp, const Real dxm,
                 const Real dxp, Real &gxm, Real &gxp) {
@@ -67,17 +237,7 @@ struct RestrictAverage {
      const parthenon::Coordinates_t &pcoarse_coords,
      const parthenon::ParArrayND<Real, parthenon::VariableState> *pcoarse,
      const parthenon::ParArrayND<Real, parthenon::VariableState> *pfine) {
-    using TE = TopologicalElement;
-
-    auto coords = Coordinates<geom>(pcoords);
-    auto coarse_coords = Coordinates<geom>(pcoarse_coords);
-
-    constexpr bool INCLUDE_X1 =
-        (DIM > 0) && (el == TE::CC || el == TE::F2 || el == TE::F3 || el == TE::E1);
-    constexpr bool INCLUDE_X2 =
-        (DIM > 1) && (el == TE::CC || el == TE::F3 || el == TE::F1 || el == TE::E2);
-    constexpr bool INCLUDE_X3 =
-        (DIM > 2) && (el == TE::CC || el == TE::F1 || el == TE::F2 || el == TE::E3);
+    using axes = util::RefinedAxes<DIM, el>;
     constexpr int element_idx = static_cast<int>(el) % 3;
 
     auto &coarse = *pcoarse;
@@ -87,36 +247,32 @@ struct RestrictAverage {
     const int j = (DIM > 1) ? (cj - cjb.s) * 2 + jb.s : jb.s;
     const int k = (DIM > 2) ? (ck - ckb.s) * 2 + kb.s : kb.s;
 
-    // JMM: If dimensionality is wrong, accesses are out of bounds. Only
-    // access cells if dimensionality is correct.
-    Real vol[2][2][2], terms[2][2][2];  // memset not available on all accelerators
+    const util::RestrictionWeights<geom, DIM, el> weights(pcoords, k, j, i);
+    Real terms[2][2][2];  // memset not available on all accelerators
     for (int ok = 0; ok < 2; ++ok) {
       for (int oj = 0; oj < 2; ++oj) {
         for (int oi = 0; oi < 2; ++oi) {
-          vol[ok][oj][oi] = terms[ok][oj][oi] = 0;
+          terms[ok][oj][oi] = 0;
         }
       }
     }
 
-    for (int ok = 0; ok < 1 + INCLUDE_X3; ++ok) {
-      for (int oj = 0; oj < 1 + INCLUDE_X2; ++oj) {
-        for (int oi = 0; oi < 1 + INCLUDE_X1; ++oi) {
-          vol[ok][oj][oi] = coords.template Volume<el>(k + ok, j + oj, i + oi);
-          terms[ok][oj][oi] =
-              vol[ok][oj][oi] * fine(element_idx, l, m, n, k + ok, j + oj, i + oi);
+    // JMM: If dimensionality is wrong, accesses are out of bounds. Only
+    // access cells if dimensionality is correct.
+    for (int ok = 0; ok < 1 + axes::X3; ++ok) {
+      for (int oj = 0; oj < 1 + axes::X2; ++oj) {
+        for (int oi = 0; oi < 1 + axes::X1; ++oi) {
+          terms[ok][oj][oi] = weights.Volume(ok, oj, oi) *
+                              fine(element_idx, l, m, n, k + ok, j + oj, i + oi);
         }
       }
     }
     // KGF: add the off-centered quantities first to preserve FP
     // symmetry
-    const Real tvol = ((vol[0][0][0] + vol[0][1][0]) + (vol[0][0][1] + vol[0][1][1])) +
-                      ((vol[1][0][0] + vol[1][1][0]) + (vol[1][0][1] + vol[1][1][1]));
     coarse(element_idx, l, m, n, ck, cj, ci) =
-        tvol > 0.0
-            ? (((terms[0][0][0] + terms[0][1][0]) + (terms[0][0][1] + terms[0][1][1])) +
-               ((terms[1][0][0] + terms[1][1][0]) + (terms[1][0][1] + terms[1][1][1]))) /
-                  tvol
-            : 0.0;
+        (((terms[0][0][0] + terms[0][1][0]) + (terms[0][0][1] + terms[0][1][1])) +
+         ((terms[1][0][0] + terms[1][1][0]) + (terms[1][0][1] + terms[1][1][1]))) *
+        weights.InverseTotal();
   }
 };
 
@@ -138,12 +294,11 @@ struct ProlongateSharedGeneral {
      const parthenon::Coordinates_t &pcoarse_coords,
      const parthenon::ParArrayND<Real, parthenon::VariableState> *pcoarse,
      const parthenon::ParArrayND<Real, parthenon::VariableState> *pfine) {
-    using util::GetGridSpacings;
     using util::GradMinMod;
-    using TE = TopologicalElement;
-
-    auto coords = Coordinates<geom>(pcoords);
-    auto coarse_coords = Coordinates<geom>(pcoarse_coords);
+    using axes = util::RefinedAxes<DIM, el>;
+    constexpr bool INCLUDE_X1 = axes::X1;
+    constexpr bool INCLUDE_X2 = axes::X2;
+    constexpr bool INCLUDE_X3 = axes::X3;
 
     auto &coarse = *pcoarse;
     auto &fine = *pfine;
@@ -154,65 +309,45 @@ struct ProlongateSharedGeneral {
     const int fj = (DIM > 1) ? (j - cjb.s) * 2 + jb.s : jb.s;
     const int fk = (DIM > 2) ? (k - ckb.s) * 2 + kb.s : kb.s;
 
-    constexpr bool INCLUDE_X1 =
-        (DIM > 0) && (el == TE::CC || el == TE::F2 || el == TE::F3 || el == TE::E1);
-    constexpr bool INCLUDE_X2 =
-        (DIM > 1) && (el == TE::CC || el == TE::F3 || el == TE::F1 || el == TE::E2);
-    constexpr bool INCLUDE_X3 =
-        (DIM > 2) && (el == TE::CC || el == TE::F1 || el == TE::F2 || el == TE::E3);
-
-    constexpr bool SCALE_BY_R =
-        (geom == Geometry::cylindrical) && (el == TE::F1 || el == TE::F2);
+    const util::ProlongationWeights<geom, DIM, el> weights(pcoords, pcoarse_coords, k, j,
+                                                           i, fk, fj, fi);
+    // only the r offset changes the scale
     auto coarse_scaled = [&](int kk, int jj, int ii) {
-      Real val = coarse(element_idx, l, m, n, kk, jj, ii);
-      if constexpr (SCALE_BY_R) {
-        val *= coarse_coords.template Xf<el, Axis::IAXIS>(ii);
-      }
-      return val;
+      return coarse(element_idx, l, m, n, kk, jj, ii) * weights.CoarseScale(ii - i);
     };
 
     const Real fc = coarse_scaled(k, j, i);
 
-    Real dx1fm = 0;
-    [[maybe_unused]] Real dx1fp = 0;
+    const Real dx1fm = weights.dxfm(0);
+    [[maybe_unused]] const Real dx1fp = weights.dxfp(0);
     [[maybe_unused]] Real gx1m = 0, gx1p = 0;
     if constexpr (INCLUDE_X1) {
-      Real dx1m, dx1p;
-      GetGridSpacings<1, el, geom>(coords, coarse_coords, cib, ib, i, fi, &dx1m, &dx1p,
-                                   &dx1fm, &dx1fp);
-
       Real gx1c = GradMinMod(fc, coarse_scaled(k, j, i - 1), coarse_scaled(k, j, i + 1),
-                             dx1m, dx1p, gx1m, gx1p);
+                             weights.dxm(0), weights.dxp(0), gx1m, gx1p);
       if constexpr (use_minmod_slope) {
         gx1m = gx1c;
         gx1p = gx1c;
       }
     }
 
-    Real dx2fm = 0;
-    [[maybe_unused]] Real dx2fp = 0;
+    const Real dx2fm = weights.dxfm(1);
+    [[maybe_unused]] const Real dx2fp = weights.dxfp(1);
     [[maybe_unused]] Real gx2m = 0, gx2p = 0;
     if constexpr (INCLUDE_X2) {
-      Real dx2m, dx2p;
-      GetGridSpacings<2, el, geom>(coords, coarse_coords, cjb, jb, j, fj, &dx2m, &dx2p,
-                                   &dx2fm, &dx2fp);
       Real gx2c = GradMinMod(fc, coarse_scaled(k, j - 1, i), coarse_scaled(k, j + 1, i),
-                             dx2m, dx2p, gx2m, gx2p);
+                             weights.dxm(1), weights.dxp(1), gx2m, gx2p);
       if constexpr (use_minmod_slope) {
         gx2m = gx2c;
         gx2p = gx2c;
       }
     }
 
-    Real dx3fm = 0;
-    [[maybe_unused]] Real dx3fp = 0;
+    const Real dx3fm = weights.dxfm(2);
+    [[maybe_unused]] const Real dx3fp = weights.dxfp(2);
     [[maybe_unused]] Real gx3m = 0, gx3p = 0;
     if constexpr (INCLUDE_X3) {
-      Real dx3m, dx3p;
-      GetGridSpacings<3, el, geom>(coords, coarse_coords, ckb, kb, k, fk, &dx3m, &dx3p,
-                                   &dx3fm, &dx3fp);
       Real gx3c = GradMinMod(fc, coarse_scaled(k - 1, j, i), coarse_scaled(k + 1, j, i),
-                             dx3m, dx3p, gx3m, gx3p);
+                             weights.dxm(2), weights.dxp(2), gx3m, gx3p);
       if constexpr (use_minmod_slope) {
         gx3m = gx3c;
         gx3p = gx3c;
@@ -229,11 +364,7 @@ struct ProlongateSharedGeneral {
     }
 
     auto set_fine_scaled = [&](int kk, int jj, int ii, Real val) {
-      if constexpr (SCALE_BY_R) {
-        const Real r = coords.template Xf<el, Axis::IAXIS>(ii);
-        val *= 1.0 / (r + std::numeric_limits<Real>::epsilon());
-      }
-      fine(element_idx, l, m, n, kk, jj, ii) = val;
+      fine(element_idx, l, m, n, kk, jj, ii) = val * weights.InverseFineScale(ii - fi);
     };
 
     // KGF: add the off-centered quantities first to preserve FP symmetry
@@ -288,6 +419,10 @@ struct ProlongateInternalTothAndRoe {
   // x-face field within the volume of a coarse cell. This is assumes that the
   // values of the fine cells on the elements corresponding with the coarse cell
   // have been filled.
+  //
+  // The internal faces of each component only depend on the shared faces, so all
+  // three components are filled together when the x-faces are, sharing the indexing
+  // & coordinates between them. There is nothing left to do for the y- & z-faces
   template <int DIM, TopologicalElement fel = TopologicalElement::CC,
             TopologicalElement cel = TopologicalElement::CC>
   KOKKOS_FORCEINLINE_FUNCTION static void
@@ -300,100 +435,119 @@ struct ProlongateInternalTothAndRoe {
      const parthenon::ParArrayND<Real, parthenon::VariableState> *,
      const parthenon::ParArrayND<Real, parthenon::VariableState> *pfine) {
     using TE = TopologicalElement;
-    using util::GradMinMod;
-
-    auto coords = Coordinates<geom>(pcoords);
-    auto coarse_coords = Coordinates<geom>(pcoarse_coords);
 
-    if constexpr (!IsSubmanifold(fel, cel)) {
+    if constexpr (fel != TE::F1 || !IsSubmanifold(fel, cel)) {
       return;
     } else {
       const int fi = (DIM > 0) ? (i - cib.s) * 2 + ib.s : ib.s;
       const int fj = (DIM > 1) ? (j - cjb.s) * 2 + jb.s : jb.s;
       const int fk = (DIM > 2) ? (k - ckb.s) * 2 + kb.s : kb.s;
 
-      // Here, we write the update for the x-component of the B-field and recover the
-      // other components by cyclic permutation
-      constexpr int element_idx = static_cast<int>(fel) % 3;
-      auto get_fine_permuted_kji = [&](int ok, int oj, int oi) -> std::array<int, 3> {
-        // Guard against offsetting in symmetry dimensions
-        constexpr int g3 = (DIM > 2);
-        constexpr int g2 = (DIM > 1);
-        if constexpr (fel == TE::F1) {
-          return {fk + ok * g3, fj + oj * g2, fi + oi};
-        } else if constexpr (fel == TE::F2) {
-          return {fk + oj * g3, fj + oi * g2, fi + ok};
-        } else {
-          return {fk + oi * g3, fj + ok * g2, fi + oj};
-        }
-      };
-      auto get_fine_permuted = [&](int eidx, int ok, int oj, int oi) -> Real & {
-        eidx = (element_idx + eidx) % 3;
+      const auto coords = Coordinates<geom>(pcoords);
+      const auto coarse_coords = Coordinates<geom>(pcoarse_coords);
+      const Kokkos::Array<Real, 3> dx{coarse_coords.Dx(Axis::IAXIS),
+                                      coarse_coords.Dx(Axis::JAXIS),
+                                      coarse_coords.Dx(Axis::KAXIS)};
+
+      ProlongateFace<DIM, TE::F1>(coords, dx, l, m, n, fk, fj, fi, *pfine);
+      ProlongateFace<DIM, TE::F2>(coords, dx, l, m, n, fk, fj, fi, *pfine);
+      ProlongateFace<DIM, TE::F3>(coords, dx, l, m, n, fk, fj, fi, *pfine);
+    }
+  }
+
+ private:
+  // fills the internal faces of the fel component of the fine cells in the coarse cell
+  // whose first fine cell is (fk, fj, fi), with dx the coarse spacings
+  template <int DIM, TopologicalElement fel>
+  KOKKOS_FORCEINLINE_FUNCTION static void
+  ProlongateFace(const Coordinates<geom> &coords, const Kokkos::Array<Real, 3> &dx,
+                 const int l, const int m, const int n, const int fk, const int fj,
+                 const int fi,
+                 const parthenon::ParArrayND<Real, parthenon::VariableState> &fine) {
+    using TE = TopologicalElement;
+    // Here, we write the update for the x-component of the B-field and recover the
+    // other components by cyclic permutation
+    constexpr int element_idx = static_cast<int>(fel) % 3;
+    // spacings along the permuted axes, the transverse components are weighted by
+    // their face areas relative to the x-faces so that non-cubic cells stay
+    // divergence free
+    const Real dx2 = dx[element_idx] * dx[element_idx];
+    const Real dy2 = dx[(element_idx + 1) % 3] * dx[(element_idx + 1) % 3];
+    const Real dz2 = dx[(element_idx + 2) % 3] * dx[(element_idx + 2) % 3];
+    const Real area2 = dx[element_idx] / dx[(element_idx + 1) % 3];
+    const Real area3 = dx[element_idx] / dx[(element_idx + 2) % 3];
+    auto get_fine_permuted_kji = [&](int ok, int oj, int oi) -> std::array<int, 3> {
+      // Guard against offsetting in symmetry dimensions
+      constexpr int g3 = (DIM > 2);
+      constexpr int g2 = (DIM > 1);
+      if constexpr (fel == TE::F1) {
+        return {fk + ok * g3, fj + oj * g2, fi + oi};
+      } else if constexpr (fel == TE::F2) {
+        return {fk + oj * g3, fj + oi * g2, fi + ok};
+      } else {
+        return {fk + oi * g3, fj + ok * g2, fi + oj};
+      }
+    };
+    auto get_fine_permuted = [&](int eidx, int ok, int oj, int oi) -> Real & {
+      eidx = (element_idx + eidx) % 3;
+      const auto [kk, jj, ii] = get_fine_permuted_kji(ok, oj, oi);
+      return fine(eidx, l, m, n, kk, jj, ii);
+    };
+    auto safe_inverse = [&](Real radius) {
+      if constexpr (geom == Geometry::cylindrical) {
+        const Real denom = radius + std::numeric_limits<Real>::epsilon();
+        return 1.0 / denom;
+      }
+      return 1.0;
+    };
+    auto get_radial_coord = [&]<int EIDX>(int ok, int oj, int oi) -> Real {
+      if constexpr (geom == Geometry::cylindrical) {
         const auto [kk, jj, ii] = get_fine_permuted_kji(ok, oj, oi);
-        return (*pfine)(eidx, l, m, n, kk, jj, ii);
-      };
-      auto safe_inverse = [&](Real radius) {
-        if constexpr (geom == Geometry::cylindrical) {
-          const Real denom = radius + std::numeric_limits<Real>::epsilon();
-          return 1.0 / denom;
-        }
-        return 1.0;
-      };
-      auto get_radial_coord = [&]<int EIDX>(int ok, int oj, int oi) -> Real {
-        if constexpr (geom == Geometry::cylindrical) {
-          const auto [kk, jj, ii] = get_fine_permuted_kji(ok, oj, oi);
-          constexpr TopologicalElement comp_el = static_cast<TopologicalElement>(
-              static_cast<int>(TE::F1) + ((element_idx + EIDX) % 3));
-          if constexpr (DIM <= 2 && comp_el == TE::F3) {
-            return 1.0;
-          }
-          return coords.template Xf<comp_el, Axis::IAXIS>(ii);
-        } else {
+        constexpr TopologicalElement comp_el = static_cast<TopologicalElement>(
+            static_cast<int>(TE::F1) + ((element_idx + EIDX) % 3));
+        if constexpr (DIM <= 2 && comp_el == TE::F3) {
           return 1.0;
         }
-      };
-
-      using iarr2 = std::array<int, 2>;
-      auto sg = [](int offset) -> Real { return offset == 0 ? -1.0 : 1.0; };
-      Real Uxx{0.0};
-      Real Vxyz{0.0};
-      Real Wxyz{0.0};
-      for (const int v : iarr2{0, 1}) {
-        for (const int u : iarr2{0, 2}) {
-          for (const int t : iarr2{0, 1}) {
-            const auto fine2 = get_fine_permuted(1, v, u, t) *
-                               get_radial_coord.template operator()<1>(v, u, t);
-            const auto fine3 = get_fine_permuted(2, u, v, t) *
-                               get_radial_coord.template operator()<2>(u, v, t);
-            Uxx += sg(t) * sg(u) * (fine2 + fine3);
-            Vxyz += sg(t) * sg(u) * sg(v) * fine2;
-            Wxyz += sg(t) * sg(u) * sg(v) * fine3;
-          }
-        }
+        return coords.template Xf<comp_el, Axis::IAXIS>(ii);
+      } else {
+        return 1.0;
       }
-      Uxx *= 0.125;
-      const int dir1 = element_idx + 1;
-      const int dir2 = (element_idx + 1) % 3 + 1;
-      const int dir3 = (element_idx + 2) % 3 + 1;
-      const auto dx2 = std::pow(coarse_coords.Dx(Axis::IAXIS), 2);
-      const auto dy2 = std::pow(coarse_coords.Dx(Axis::JAXIS), 2);
-      const auto dz2 = std::pow(coarse_coords.Dx(Axis::KAXIS), 2);
-      Vxyz *= 0.125 * dz2 / (dx2 + dz2);
-      Wxyz *= 0.125 * dy2 / (dx2 + dy2);
-
-      for (int ok : iarr2{0, 1}) {
-        for (int oj : iarr2{0, 1}) {
-          get_fine_permuted(0, ok, oj, 1) =
-              0.5 * (get_fine_permuted(0, ok, oj, 0) *
-                         get_radial_coord.template operator()<0>(ok, oj, 0) +
-                     get_fine_permuted(0, ok, oj, 2) *
-                         get_radial_coord.template operator()<0>(ok, oj, 2)) +
-              Uxx + sg(ok) * Vxyz + sg(oj) * Wxyz;
-          get_fine_permuted(0, ok, oj, 1) *=
-              safe_inverse(get_radial_coord.template operator()<0>(ok, oj, 1));
+    };
+
+    using iarr2 = std::array<int, 2>;
+    auto sg = [](int offset) -> Real { return offset == 0 ? -1.0 : 1.0; };
+    Real Uxx{0.0};
+    Real Vxyz{0.0};
+    Real Wxyz{0.0};
+    for (const int v : iarr2{0, 1}) {
+      for (const int u : iarr2{0, 2}) {
+        for (const int t : iarr2{0, 1}) {
+          const auto fine2 = area2 * get_fine_permuted(1, v, u, t) *
+                             get_radial_coord.template operator()<1>(v, u, t);
+          const auto fine3 = area3 * get_fine_permuted(2, u, v, t) *
+                             get_radial_coord.template operator()<2>(u, v, t);
+          Uxx += sg(t) * sg(u) * (fine2 + fine3);
+          Vxyz += sg(t) * sg(u) * sg(v) * fine2;
+          Wxyz += sg(t) * sg(u) * sg(v) * fine3;
         }
       }
     }
+    Uxx *= 0.125;
+    Vxyz *= 0.125 * dz2 / (dx2 + dz2);
+    Wxyz *= 0.125 * dy2 / (dx2 + dy2);
+
+    for (int ok : iarr2{0, 1}) {
+      for (int oj : iarr2{0, 1}) {
+        get_fine_permuted(0, ok, oj, 1) =
+            0.5 * (get_fine_permuted(0, ok, oj, 0) *
+                       get_radial_coord.template operator()<0>(ok, oj, 0) +
+                   get_fine_permuted(0, ok, oj, 2) *
+                       get_radial_coord.template operator()<0>(ok, oj, 2)) +
+            Uxx + sg(ok) * Vxyz + sg(oj) * Wxyz;
+        get_fine_permuted(0, ok, oj, 1) *=
+            safe_inverse(get_radial_coord.template operator()<0>(ok, oj, 1));
+      }
+    }
   }
 };
 
@@ -16,13 +16,15 @@
 #include "kamayan_utils/type_abstractions.hpp"
 
 namespace kamayan::grid {
+// coordinate packs are computed from the coordinates of each block
 parthenon::BlockList_t MakeTestBlockList(const std::shared_ptr<KamayanUnit> pkg,
-                                         const int NBLOCKS, const int NXB,
-                                         const int NDIM) {
+                                         const int NBLOCKS, const int NXB, const int NDIM,
+                                         const parthenon::Coordinates_t &coords) {
   parthenon::BlockList_t block_list;
   block_list.reserve(NBLOCKS);
   for (int i = 0; i < NBLOCKS; ++i) {
     auto pmb = std::make_shared<parthenon::MeshBlock>(NXB, NDIM);
+    pmb->coords = coords;
     auto &pmbd = pmb->meshblock_data.Get();
     pmbd->Initialize(pkg, pmb);
     block_list.push_back(pmb);
@@ -88,13 +90,12 @@ template <Geometry geom>
 auto MakeCoords() {
   if constexpr (geom == Geometry::cylindrical) {
     return MakeCoordinatesCylindrical2D();
-  } else if constexpr (geom == Geometry::cartesian) {
-    return MakeCoordinatesCartesian3D();
   } else {
+    // cartesian packs are analytic and tested against closed form values
     static_assert(always_false<Coordinates<geom>>, "Can't make coordinates for geometry");
   }
 
-  return MakeCoordinatesCartesian3D();
+  return MakeCoordinatesCylindrical2D();
 }
 
 template <Geometry geom>
@@ -111,7 +112,7 @@ void TestCoordsPackDx() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -170,7 +171,7 @@ void TestCoordsPackVolume() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -216,7 +217,7 @@ void TestCoordsPackX() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -275,7 +276,7 @@ void TestCoordsPackXc() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -334,7 +335,7 @@ void TestCoordsPackFaceArea() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -395,7 +396,7 @@ void TestCoordsPackEdgeLength() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -456,7 +457,7 @@ void TestCoordsPackXf() {
 
   AddCoordFields(pkg.get(), geom, NXB, NXB, NXB);
 
-  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoords<geom>());
   auto md = MakeTestMeshData(block_list);
 
   auto pack = GetPack(CoordFields(), pkg.get(), &md);
@@ -501,33 +502,69 @@ void TestCoordsPackXf() {
   EXPECT_EQ(n_wrong, 0);
 }
 
-TEST(CoordinatePackTest, CartesianDx) { TestCoordsPackDx<Geometry::cartesian>(); }
-TEST(CoordinatePackTest, CylindricalDx) { TestCoordsPackDx<Geometry::cylindrical>(); }
+// cartesian packs hold no coordinate fields, so nothing is registered or filled and
+// the pack is checked against the uniform [0,1]^3 grid with 8 cells per side
+TEST(CoordinatePackTest, CartesianAnalytic) {
+  constexpr int NDIM = 3;
+  constexpr int NXB = 8;
+  constexpr int NBLOCKS = 1;
+  constexpr Real dx = 1.0 / NXB;
 
-TEST(CoordinatePackTest, CartesianX) { TestCoordsPackX<Geometry::cartesian>(); }
-TEST(CoordinatePackTest, CylindricalX) { TestCoordsPackX<Geometry::cylindrical>(); }
+  auto pkg = std::make_shared<KamayanUnit>("Test Package");
+  auto rps = std::make_shared<runtime_parameters::RuntimeParameters>();
+  auto cfg = std::make_shared<Config>();
+  cfg->Add(Geometry::cartesian);
+  pkg->InitResources(rps, cfg);
 
-TEST(CoordinatePackTest, CartesianXc) { TestCoordsPackXc<Geometry::cartesian>(); }
-TEST(CoordinatePackTest, CylindricalXc) { TestCoordsPackXc<Geometry::cylindrical>(); }
+  auto block_list =
+      MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM, MakeCoordinatesCartesian3D());
+  auto md = MakeTestMeshData(block_list);
 
-TEST(CoordinatePackTest, CartesianXf) { TestCoordsPackXf<Geometry::cartesian>(); }
-TEST(CoordinatePackTest, CylindricalXf) { TestCoordsPackXf<Geometry::cylindrical>(); }
+  auto pack = GetPack(CoordFields(), pkg.get(), &md);
 
-TEST(CoordinatePackTest, CartesianVolume) { TestCoordsPackVolume<Geometry::cartesian>(); }
-TEST(CoordinatePackTest, CylindricalVolume) {
-  TestCoordsPackVolume<Geometry::cylindrical>();
+  auto ib = md.GetBoundsI(parthenon::IndexDomain::interior);
+  auto jb = md.GetBoundsJ(parthenon::IndexDomain::interior);
+  auto kb = md.GetBoundsK(parthenon::IndexDomain::interior);
+
+  int n_wrong = 0;
+  parthenon::par_reduce(
+      PARTHENON_AUTO_LABEL, 0, NBLOCKS - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+      KOKKOS_LAMBDA(const int b, const int k, const int j, const int i, int &nw) {
+        auto cpack = CoordinatePack<Geometry::cartesian>(pack, b);
+        const Real xf[3] = {(k - kb.s) * dx, (j - jb.s) * dx, (i - ib.s) * dx};
+        auto check = [&](const Real value, const Real expected) {
+          if (Kokkos::abs(value - expected) > 1e-10) nw += 1;
+        };
+        check(cpack.CellVolume(k, j, i), dx * dx * dx);
+        [&]<Axis... axes>() {
+          (
+              [&]<Axis ax>() {
+                const int d = static_cast<int>(ax);
+                check(cpack.template Dx<ax>(k, j, i), dx);
+                check(cpack.template Xf<ax>(k, j, i), xf[d]);
+                check(cpack.template Xc<ax>(k, j, i), xf[d] + 0.5 * dx);
+                check(cpack.template X<ax>(k, j, i), xf[d] + 0.5 * dx);
+                check(cpack.template FaceArea<ax>(k, j, i), dx * dx);
+                check(cpack.template EdgeLength<ax>(k, j, i), dx);
+              }.template operator()<axes>(),
+              ...);
+        }.template operator()<Axis::KAXIS, Axis::JAXIS, Axis::IAXIS>();
+      },
+      Kokkos::Sum<int>(n_wrong));
+
+  EXPECT_EQ(n_wrong, 0);
 }
 
-TEST(CoordinatePackTest, CartesianFaceArea) {
-  TestCoordsPackFaceArea<Geometry::cartesian>();
+TEST(CoordinatePackTest, CylindricalDx) { TestCoordsPackDx<Geometry::cylindrical>(); }
+TEST(CoordinatePackTest, CylindricalX) { TestCoordsPackX<Geometry::cylindrical>(); }
+TEST(CoordinatePackTest, CylindricalXc) { TestCoordsPackXc<Geometry::cylindrical>(); }
+TEST(CoordinatePackTest, CylindricalXf) { TestCoordsPackXf<Geometry::cylindrical>(); }
+TEST(CoordinatePackTest, CylindricalVolume) {
+  TestCoordsPackVolume<Geometry::cylindrical>();
 }
 TEST(CoordinatePackTest, CylindricalFaceArea) {
   TestCoordsPackFaceArea<Geometry::cylindrical>();
 }
-
-TEST(CoordinatePackTest, CartesianEdgeLength) {
-  TestCoordsPackEdgeLength<Geometry::cartesian>();
-}
 TEST(CoordinatePackTest, CylindricalEdgeLength) {
   TestCoordsPackEdgeLength<Geometry::cylindrical>();
 }
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <stdexcept>
 
 #include <mesh/meshblock.hpp>
 
@@ -214,4 +215,41 @@ TEST(ScratchVarTest, SubPack) {
   EXPECT_EQ(nwrong, 0) << "scratch-pack needs to agree with pack";
 }
 
+// kamayan/refinement/derefine_votes is forwarded one to one as parthenon's count of
+// consecutive derefinement tags
+std::unique_ptr<parthenon::ParameterInput> SetupGridParams(const int derefine_votes,
+                                                          const int derefine_count) {
+  auto in = std::make_unique<parthenon::ParameterInput>();
+  if (derefine_votes > 0) {
+    in->SetInteger("kamayan/refinement", "derefine_votes", derefine_votes);
+  }
+  if (derefine_count > 0) {
+    in->SetInteger("parthenon/mesh", "derefine_count", derefine_count);
+  }
+  auto rps = std::make_shared<runtime_parameters::RuntimeParameters>(in.get());
+  auto unit = std::make_shared<KamayanUnit>("grid");
+  unit->InitResources(rps, std::make_shared<Config>());
+  grid::SetupParams(unit.get());
+  return in;
+}
+
+TEST(grid, DerefineVotes) {
+  auto in = SetupGridParams(4, 0);
+  EXPECT_EQ(in->GetInteger("parthenon/mesh", "derefine_count"), 4);
+  EXPECT_EQ(in->GetInteger("kamayan/refinement", "derefine_votes"), 4);
+
+  in = SetupGridParams(0, 7);
+  EXPECT_EQ(in->GetInteger("parthenon/mesh", "derefine_count"), 7);
+  EXPECT_EQ(in->GetInteger("kamayan/refinement", "derefine_votes"), 7);
+
+  in = SetupGridParams(0, 0);
+  EXPECT_EQ(in->GetInteger("parthenon/mesh", "derefine_count"), 10);
+  EXPECT_EQ(in->GetInteger("kamayan/refinement", "derefine_votes"), 10);
+
+  in = SetupGridParams(3, 3);
+  EXPECT_EQ(in->GetInteger("parthenon/mesh", "derefine_count"), 3);
+
+  EXPECT_THROW(SetupGridParams(3, 2), std::runtime_error);
+}
+
 }  // namespace kamayan
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mesh/meshblock.hpp>
+#include <parameter_input.hpp>
+
+#include "grid/grid.hpp"
+#include "grid/grid_refinement.hpp"
+#include "grid/grid_types.hpp"
+#include "grid/tests/test_geometry.hpp"
+#include "grid/tests/test_grid.hpp"
+#include "kamayan/config.hpp"
+#include "kamayan/fields.hpp"
+#include "kamayan/runtime_parameters.hpp"
+#include "kamayan/unit.hpp"
+
+namespace kamayan::grid {
+// blocks covering [0,1]^3 with 8 cells per side, so every dx is 1/8
+parthenon::BlockList_t MakeRefinementBlockList(const std::shared_ptr<KamayanUnit> pkg,
+                                               const int NBLOCKS, const int NDIM) {
+  parthenon::BlockList_t block_list;
+  block_list.reserve(NBLOCKS);
+  for (int i = 0; i < NBLOCKS; ++i) {
+    auto pmb = std::make_shared<parthenon::MeshBlock>(8, NDIM);
+    pmb->coords = MakeCoordinatesCartesian3D();
+    auto &pmbd = pmb->meshblock_data.Get();
+    pmbd->Initialize(pkg, pmb);
+    block_list.push_back(pmb);
+  }
+  return block_list;
+}
+
+std::shared_ptr<KamayanUnit> MakeRefinementUnit() {
+  auto pkg = std::make_shared<KamayanUnit>("Test Package");
+  auto rps = std::make_shared<runtime_parameters::RuntimeParameters>();
+  auto cfg = std::make_shared<Config>();
+  cfg->Add(Geometry::cartesian);
+  pkg->InitResources(rps, cfg);
+  return pkg;
+}
+
+TEST(RefinementBuffer, HydroFastSpeed) {
+  constexpr int NDIM = 2;
+  constexpr int NBLOCKS = 2;
+  constexpr Real dx = 0.125;
+
+  // without mhd the hydro caches a single fast speed
+  auto pkg = MakeRefinementUnit();
+  AddField<VELOCITY>(pkg.get(), {Metadata::Cell});
+  AddField<CFAST>(pkg.get(), {Metadata::Cell}, {1});
+
+  auto block_list = MakeRefinementBlockList(pkg, NBLOCKS, NDIM);
+  auto md = MakeTestMeshData(block_list);
+  auto pack = GetPack<VELOCITY, CFAST>(pkg.get(), &md);
+
+  auto ib = md.GetBoundsI(IndexDomain::entire);
+  auto jb = md.GetBoundsJ(IndexDomain::entire);
+  auto kb = md.GetBoundsK(IndexDomain::entire);
+  parthenon::par_for(
+      PARTHENON_AUTO_LABEL, 0, NBLOCKS - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+      KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
+        pack(b, VELOCITY(0), k, j, i) = b == 0 ? 1.0 : 0.0;
+        pack(b, VELOCITY(1), k, j, i) = b == 0 ? 2.0 : 20.0;
+        pack(b, VELOCITY(2), k, j, i) = 100.0;
+        pack(b, CFAST(), k, j, i) = b == 0 ? 3.0 : 0.5;
+      });
+
+  const Real dt = 0.02;
+  const Real buffer = 1.0;
+  const int tag_interval = 2;
+  const int nbuf_max = 4;
+  auto nbuf = RefinementBuffer(&md, pkg.get(), NDIM, dt, buffer, tag_interval, nbuf_max);
+  auto nbuf_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nbuf);
+
+  // the fast speed is added along both directions & the velocity out of plane ignored
+  const Real rate0 = (2.0 + 3.0) / dx;
+  EXPECT_EQ(nbuf_h(0), static_cast<int>(std::ceil(buffer * rate0 * dt * tag_interval)));
+  EXPECT_EQ(nbuf_h(0), 2);
+  // a fast block is capped
+  EXPECT_EQ(nbuf_h(1), nbuf_max);
+
+  // and no buffer when disabled
+  nbuf = RefinementBuffer(&md, pkg.get(), NDIM, dt, 0.0, tag_interval, nbuf_max);
+  nbuf_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nbuf);
+  EXPECT_EQ(nbuf_h(0), 0);
+  EXPECT_EQ(nbuf_h(1), 0);
+}
+
+// pin with a <kamayan/refinementN> block for each field, processed by the grid unit
+std::unique_ptr<parthenon::ParameterInput>
+SetupLoehnerParams(const std::vector<std::string> &fields,
+                   const std::vector<int> &max_levels) {
+  auto in = std::make_unique<parthenon::ParameterInput>();
+  in->SetInteger("parthenon/mesh", "numlevel", 10);
+  for (int n = 0; n < fields.size(); n++) {
+    const std::string block = "kamayan/refinement" + std::to_string(n);
+    in->SetString(block, "field", fields[n]);
+    in->SetReal(block, "refine_tol", 0.5);
+    in->SetReal(block, "derefine_tol", 0.1);
+    in->SetInteger(block, "max_level", max_levels[n]);
+  }
+  return in;
+}
+
+parthenon::ParArray1D<AmrTag> LoehnerTags(const std::vector<std::string> &fields,
+                                          const std::vector<int> &max_levels,
+                                          KamayanUnit *pkg, MeshData *md,
+                                          const int ndim) {
+  auto in = SetupLoehnerParams(fields, max_levels);
+  auto rps = std::make_shared<runtime_parameters::RuntimeParameters>(in.get());
+  auto unit = std::make_shared<KamayanUnit>("grid");
+  unit->InitResources(rps, std::make_shared<Config>());
+  SetupParams(unit.get());
+  std::vector<std::string> block_names;
+  for (int n = 0; n < fields.size(); n++) {
+    block_names.push_back("kamayan/refinement" + std::to_string(n));
+  }
+  const AMRLoehner loehner(rps.get(), block_names);
+
+  const int nblocks = md->NumBlocks();
+  parthenon::ParArray1D<AmrTag> delta_level("delta_level", nblocks);
+  parthenon::par_for(
+      PARTHENON_AUTO_LABEL, 0, nblocks - 1,
+      KOKKOS_LAMBDA(const int b) { delta_level(b) = AmrTag::derefine; });
+  loehner.Tag(md, pkg, ndim, Kokkos::View<int *>("nbuf", nblocks), delta_level);
+  return delta_level;
+}
+
+TEST(AMRLoehner, MultipleFields) {
+  constexpr int NDIM = 2;
+  constexpr int NBLOCKS = 2;
+
+  auto pkg = MakeRefinementUnit();
+  AddField<DENS>(pkg.get(), {Metadata::Cell});
+  AddField<PRES>(pkg.get(), {Metadata::Cell});
+
+  auto block_list = MakeRefinementBlockList(pkg, NBLOCKS, NDIM);
+  auto md = MakeTestMeshData(block_list);
+  auto pack = GetPack<DENS, PRES>(pkg.get(), &md);
+
+  // the density jumps across the first block & is uniform in the second,
+  // while the pressure is uniform everywhere
+  auto ib = md.GetBoundsI(IndexDomain::entire);
+  auto jb = md.GetBoundsJ(IndexDomain::entire);
+  auto kb = md.GetBoundsK(IndexDomain::entire);
+  const int imid = (md.GetBoundsI(IndexDomain::interior).s +
+                    md.GetBoundsI(IndexDomain::interior).e) /
+                   2;
+  Kokkos::View<int> level("level");
+  parthenon::par_for(
+      PARTHENON_AUTO_LABEL, 0, NBLOCKS - 1, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+      KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
+        pack(b, DENS(), k, j, i) = (b == 0 && i > imid) ? 10.0 : 1.0;
+        pack(b, PRES(), k, j, i) = 1.0;
+        if (b == 0 && k == kb.s && j == jb.s && i == ib.s) {
+          level() = pack.GetLevel(b, 0, 0, 0);
+        }
+      });
+  const int lvl = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), level)();
+
+  // the density asks for refinement & the pressure for derefinement, so the first
+  // block is refined while all fields agree to derefine the second
+  auto tags = LoehnerTags({DENS::name(), PRES::name()}, {lvl + 1, lvl + 1}, pkg.get(),
+                          &md, NDIM)
+                  .GetHostMirrorAndCopy();
+  EXPECT_EQ(tags(0), AmrTag::refine);
+  EXPECT_EQ(tags(1), AmrTag::derefine);
+
+  // regardless of the order of the fields
+  tags = LoehnerTags({PRES::name(), DENS::name()}, {lvl + 1, lvl + 1}, pkg.get(), &md,
+                     NDIM)
+             .GetHostMirrorAndCopy();
+  EXPECT_EQ(tags(0), AmrTag::refine);
+  EXPECT_EQ(tags(1), AmrTag::derefine);
+
+  // a density capped at the current level can only hold the first block there,
+  // while the pressure is still free to refine further
+  tags = LoehnerTags({DENS::name(), PRES::name()}, {lvl, lvl + 1}, pkg.get(), &md, NDIM)
+             .GetHostMirrorAndCopy();
+  EXPECT_EQ(tags(0), AmrTag::same);
+  EXPECT_EQ(tags(1), AmrTag::derefine);
+}
+}  // namespace kamayan::grid
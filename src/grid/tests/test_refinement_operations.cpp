@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include <coordinates/uniform_cartesian.hpp>
+#include <kokkos_abstraction.hpp>
+
+#include "grid/geometry_types.hpp"
+#include "grid/refinement_operations.hpp"
+
+namespace kamayan::grid {
+
+namespace {
+// a coarse block & the block covering it with twice the resolution
+parthenon::UniformCartesian MakeCoordinates(const int nx,
+                                            const std::array<Real, 3> xmax = {1.0, 2.0,
+                                                                              3.0}) {
+  return parthenon::UniformCartesian(
+      parthenon::RegionSize({0.0, 0.0, 0.0}, {xmax[0], xmax[1], xmax[2]},
+                            {1.0, 1.0, 1.0}, {nx, nx, nx}),
+      nullptr);
+}
+
+// B = curl A for A = (g(y, z), h(z, x), f(x, y)), so the face averages of B follow
+// from the circulation of A around each face & are discretely divergence free
+using Potential = Real (*)(const Real, const Real);
+struct CurlField {
+  Potential f, g, h;
+
+  // average of component comp over the face with lower corner x0 & sides dx
+  Real FaceAverage(const int comp, const std::array<Real, 3> &x0,
+                   const std::array<Real, 3> &dx) const {
+    const auto [x, y, z] = x0;
+    if (comp == 0) {
+      return (f(x, y + dx[1]) - f(x, y)) / dx[1] - (h(z + dx[2], x) - h(z, x)) / dx[2];
+    } else if (comp == 1) {
+      return (g(y, z + dx[2]) - g(y, z)) / dx[2] - (f(x + dx[0], y) - f(x, y)) / dx[0];
+    }
+    return (h(z, x + dx[0]) - h(z, x)) / dx[0] - (g(y + dx[1], z) - g(y, z)) / dx[1];
+  }
+};
+
+Real Quadratic0(const Real a, const Real b) { return 3.0 * a * b + b * b; }
+Real Quadratic1(const Real a, const Real b) { return 2.0 * a * b + b * b; }
+Real Quadratic2(const Real a, const Real b) { return a * b + 0.5 * b * b; }
+Real Smooth0(const Real a, const Real b) {
+  return std::sin(3.0 * a) * std::cos(2.0 * b) + a * b * b;
+}
+Real Smooth1(const Real a, const Real b) { return std::cos(a + 2.0 * b) + a * a * b; }
+Real Smooth2(const Real a, const Real b) { return std::sin(a * b) + a * b * b; }
+
+using FaceArray = parthenon::ParArrayND<Real, parthenon::VariableState>;
+
+// the faces of the 2^3 fine cells covering the first coarse cell of a block covering
+// [0, xmax] with 8 cells per side, the internal faces are filled by Toth & Roe
+FaceArray ProlongateCoarseCell(const CurlField &field, const std::array<Real, 3> xmax) {
+  using TE = TopologicalElement;
+  const auto coarse = MakeCoordinates(8, xmax);
+  const auto fine = MakeCoordinates(16, xmax);
+  const std::array<Real, 3> dx{xmax[0] / 16.0, xmax[1] / 16.0, xmax[2] / 16.0};
+
+  FaceArray faces("faces", parthenon::VariableState(), 3, 1, 1, 1, 3, 3, 3);
+  auto faces_h = faces.GetHostMirror();
+  for (int comp = 0; comp < 3; comp++) {
+    for (int k = 0; k < 3; k++) {
+      for (int j = 0; j < 3; j++) {
+        for (int i = 0; i < 3; i++) {
+          const std::array<int, 3> idx{i, j, k};
+          // the internal faces must all be overwritten
+          faces_h(comp, 0, 0, 0, k, j, i) =
+              idx[comp] == 1
+                  ? 1.0e10
+                  : field.FaceAverage(comp, {i * dx[0], j * dx[1], k * dx[2]}, dx);
+        }
+      }
+    }
+  }
+  faces.DeepCopy(faces_h);
+
+  const parthenon::IndexRange cb{0, 0};
+  const parthenon::IndexRange fb{0, 1};
+  parthenon::par_for(
+      PARTHENON_AUTO_LABEL, 0, 0, KOKKOS_LAMBDA(const int) {
+        using Op = ProlongateInternalTothAndRoe<Geometry::cartesian>;
+        Op::Do<3, TE::F1, TE::CC>(0, 0, 0, 0, 0, 0, cb, cb, cb, fb, fb, fb, fine, coarse,
+                                  nullptr, &faces);
+        Op::Do<3, TE::F2, TE::CC>(0, 0, 0, 0, 0, 0, cb, cb, cb, fb, fb, fb, fine, coarse,
+                                  nullptr, &faces);
+        Op::Do<3, TE::F3, TE::CC>(0, 0, 0, 0, 0, 0, cb, cb, cb, fb, fb, fb, fine, coarse,
+                                  nullptr, &faces);
+      });
+  return faces;
+}
+
+Real MaxDivergence(const FaceArray &faces, const std::array<Real, 3> xmax) {
+  auto b = faces.GetHostMirrorAndCopy();
+  const std::array<Real, 3> dx{xmax[0] / 16.0, xmax[1] / 16.0, xmax[2] / 16.0};
+  Real max_div = 0.0;
+  for (int k = 0; k < 2; k++) {
+    for (int j = 0; j < 2; j++) {
+      for (int i = 0; i < 2; i++) {
+        const Real div = (b(0, 0, 0, 0, k, j, i + 1) - b(0, 0, 0, 0, k, j, i)) / dx[0] +
+                         (b(1, 0, 0, 0, k, j + 1, i) - b(1, 0, 0, 0, k, j, i)) / dx[1] +
+                         (b(2, 0, 0, 0, k + 1, j, i) - b(2, 0, 0, 0, k, j, i)) / dx[2];
+        max_div = std::max(max_div, std::abs(div));
+      }
+    }
+  }
+  return max_div;
+}
+}  // namespace
+
+TEST(RefinementOperations, CartesianProlongationWeights) {
+  using TE = TopologicalElement;
+  const auto coarse = MakeCoordinates(8);
+  const auto fine = MakeCoordinates(16);
+  const auto coarse_coords = Coordinates<Geometry::cartesian>(coarse);
+  const auto coords = Coordinates<Geometry::cartesian>(fine);
+  using Weights = util::ProlongationWeights<Geometry::cartesian, 3, TE::CC>;
+  const Weights weights(fine, coarse, 4, 4, 4, 8, 8, 8);
+
+  // the constant weights are relative to the coarse spacing along each axis
+  Real dxm, dxp, dxfm, dxfp;
+  util::GetGridSpacings<1, TE::CC>(coords, coarse_coords, 4, 8, &dxm, &dxp, &dxfm, &dxfp);
+  EXPECT_DOUBLE_EQ(dxfm / dxm, weights.dxfm(0) / weights.dxm(0));
+  EXPECT_DOUBLE_EQ(dxfp / dxp, weights.dxfp(0) / weights.dxp(0));
+  util::GetGridSpacings<3, TE::CC>(coords, coarse_coords, 4, 8, &dxm, &dxp, &dxfm, &dxfp);
+  EXPECT_DOUBLE_EQ(dxfm / dxm, weights.dxfm(2) / weights.dxm(2));
+  EXPECT_DOUBLE_EQ(dxfp / dxp, weights.dxfp(2) / weights.dxp(2));
+
+  // faces aren't refined along their normal
+  using FaceWeights = util::ProlongationWeights<Geometry::cartesian, 3, TE::F1>;
+  EXPECT_EQ(FaceWeights::dxfm(0), 0.0);
+  EXPECT_EQ(FaceWeights::dxfm(1), 0.25);
+}
+
+template <int DIM, TopologicalElement el>
+using CartesianRestriction = util::RestrictionWeights<Geometry::cartesian, DIM, el>;
+
+TEST(RefinementOperations, CartesianRestrictionWeights) {
+  using TE = TopologicalElement;
+  // an average over the fine elements in each refined direction
+  EXPECT_DOUBLE_EQ((CartesianRestriction<3, TE::CC>::InverseTotal()), 0.125);
+  EXPECT_DOUBLE_EQ((CartesianRestriction<2, TE::CC>::InverseTotal()), 0.25);
+  EXPECT_DOUBLE_EQ((CartesianRestriction<3, TE::F1>::InverseTotal()), 0.25);
+  EXPECT_EQ((CartesianRestriction<2, TE::CC>::Volume(1, 0, 0)), 0.0);
+}
+
+TEST(RefinementOperations, TothAndRoeDivergenceFree) {
+  // non-cubic cells, so that each component sees different spacings
+  const std::array<Real, 3> xmax{1.0, 2.0, 3.0};
+  const CurlField smooth{Smooth0, Smooth1, Smooth2};
+  const auto faces = ProlongateCoarseCell(smooth, xmax);
+  EXPECT_LT(MaxDivergence(faces, xmax), 1.0e-10);
+
+  // the y- & z-faces, filled alongside the x-faces, match the x-face prolongation of
+  // the same field with the axes cycled so that they become the x-faces
+  const CurlField cycled{Smooth1, Smooth2, Smooth0};
+  const auto cycled_faces = ProlongateCoarseCell(cycled, {xmax[1], xmax[2], xmax[0]});
+  const CurlField cycled2{Smooth2, Smooth0, Smooth1};
+  const auto cycled2_faces = ProlongateCoarseCell(cycled2, {xmax[2], xmax[0], xmax[1]});
+  auto b = faces.GetHostMirrorAndCopy();
+  auto b1 = cycled_faces.GetHostMirrorAndCopy();
+  auto b2 = cycled2_faces.GetHostMirrorAndCopy();
+  for (int ok = 0; ok < 2; ok++) {
+    for (int oj = 0; oj < 2; oj++) {
+      EXPECT_NEAR(b(1, 0, 0, 0, oj, 1, ok), b1(0, 0, 0, 0, ok, oj, 1), 1.0e-12);
+      EXPECT_NEAR(b(2, 0, 0, 0, 1, ok, oj), b2(0, 0, 0, 0, ok, oj, 1), 1.0e-12);
+    }
+  }
+
+  // and a linear field is recovered exactly
+  const CurlField linear{Quadratic0, Quadratic1, Quadratic2};
+  const auto linear_faces = ProlongateCoarseCell(linear, xmax);
+  auto bl = linear_faces.GetHostMirrorAndCopy();
+  const std::array<Real, 3> dx{xmax[0] / 16.0, xmax[1] / 16.0, xmax[2] / 16.0};
+  for (int ok = 0; ok < 2; ok++) {
+    for (int oj = 0; oj < 2; oj++) {
+      EXPECT_NEAR(bl(0, 0, 0, 0, ok, oj, 1),
+                  linear.FaceAverage(0, {dx[0], oj * dx[1], ok * dx[2]}, dx), 1.0e-12);
+      EXPECT_NEAR(bl(1, 0, 0, 0, oj, 1, ok),
+                  linear.FaceAverage(1, {ok * dx[0], dx[1], oj * dx[2]}, dx), 1.0e-12);
+      EXPECT_NEAR(bl(2, 0, 0, 0, 1, ok, oj),
+                  linear.FaceAverage(2, {oj * dx[0], ok * dx[1], dx[2]}, dx), 1.0e-12);
+    }
+  }
+}
+
+}  // namespace kamayan::grid
@@ -205,6 +205,9 @@ using PRAD = VariableBase<"prad">;
 
 // derived
 using DIVB = VariableBase<"divb">;
+// cell centered fast magnetosonic speed along each direction, or just the
+// sound speed in the first component without mhd
+using CFAST = VariableBase<"cfast", VariableRank::scalar, 3>;
 
 // debug
 using DEBUG = VariableBase<"debug">;
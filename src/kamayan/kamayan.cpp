@@ -108,6 +108,12 @@ KamayanDriver InitPackages(std::shared_ptr<ParthenonManager> pman,
                        "InitMeshBlockUserData");
   };
 
+  // lazily derived fields are only filled when we need to write them out
+  pman->app_input->UserMeshWorkBeforeOutput = [units](Mesh *mesh, ParameterInput *pin,
+                                                      SimTime const &tm) {
+    units->FillLazyDerived(mesh, tm.ncycle);
+  };
+
   // maybe this should be a part of all the units...
   pman->app_input->PreStepMeshUserWorkInLoop = driver::PreStepUserWorkInLoop;
 
@@ -144,6 +150,7 @@ void Finalize(std::shared_ptr<ParthenonManager> pman) {
     pman->app_input->ProblemGenerator = nullptr;
     pman->app_input->MeshPostInitialization = nullptr;
     pman->app_input->InitMeshBlockUserData = nullptr;
+    pman->app_input->UserMeshWorkBeforeOutput = nullptr;
     pman->app_input->PreStepMeshUserWorkInLoop = nullptr;
   }
   pman->ProcessPackages = nullptr;
@@ -82,4 +82,54 @@ TEST(KamayanUnit, UnitCollection) {
       [&](KamayanUnit *u) { auto tid = u->AddTasksSplit(none, tl, &md, 0.0); },
       "OneStep");
 }
+
+TEST(KamayanUnit, FuseCallbacks) {
+  UnitCollection unit_collection;
+  for (const auto &name : {"one", "two", "three", "four", "owner"}) {
+    unit_collection[name] = std::make_shared<KamayanUnit>(name);
+  }
+  const auto prepare = [](MeshData *md) { return TaskStatus::complete; };
+  unit_collection["one"]->PreparePrimitive.Register(prepare, {}, {"three"});
+  unit_collection["two"]->PreparePrimitive.Register(prepare, {"one"}, {});
+  unit_collection["three"]->PreparePrimitive.Register(prepare, {"two"}, {});
+  unit_collection["four"]->PreparePrimitive.Register(prepare, {"three"}, {});
+
+  const auto getter = [](KamayanUnit *u) -> auto & { return u->PreparePrimitive; };
+  const auto order = unit_collection.FuseCallbacks(
+      getter, "owner", {"one", "two", "three"}, prepare, "PreparePrimitive");
+  EXPECT_EQ(order, (std::vector<std::string>{"one", "two", "three"}));
+
+  // fused units are replaced by the owner, which keeps their place in the DAG
+  for (const auto &name : order) {
+    EXPECT_FALSE(unit_collection.Get(name)->PreparePrimitive.IsRegistered());
+  }
+  EXPECT_EQ(unit_collection.BuildExecutionOrder(getter, "PreparePrimitive"),
+            (std::vector<std::string>{"owner", "four"}));
+}
+
+TEST(KamayanUnit, LazyDerived) {
+  auto unit = std::make_shared<KamayanUnit>("lazy");
+  int nfills = 0;
+  unit->AddLazyDerived("field", [&](MeshData *md) {
+    nfills++;
+    return TaskStatus::complete;
+  });
+  ASSERT_EQ(unit->LazyDerived().count("field"), 1);
+  auto &lazy = unit->LazyDerived().at("field");
+  EXPECT_EQ(nfills, 0);
+
+  MeshData md1, md2;
+  const std::vector<MeshData *> partitions{&md1, &md2};
+  // filled over every partition the first time it is asked for
+  lazy.Fill(partitions, 3);
+  EXPECT_EQ(nfills, 2);
+
+  // still valid for the rest of the cycle
+  lazy.Fill(partitions, 3);
+  EXPECT_EQ(nfills, 2);
+
+  // and filled again once the mesh has moved on
+  lazy.Fill(partitions, 4);
+  EXPECT_EQ(nfills, 4);
+}
 }  // namespace kamayan::mock
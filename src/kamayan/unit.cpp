@@ -68,6 +68,13 @@ KamayanUnit::GetUnitPtr(const std::string &name) const {
   return units->Get(name);
 }
 
+std::shared_ptr<const UnitCollection> KamayanUnit::GetUnits() const {
+  auto units = units_.lock();
+  PARTHENON_REQUIRE_THROWS(units != nullptr,
+                           "UnitCollection has been destroyed or not set.");
+  return units;
+}
+
 std::shared_ptr<KamayanUnit> KamayanUnit::GetFromMesh(MeshData *md,
                                                       const std::string &name) {
   auto pkg = md->GetMeshPointer()->packages.Get(name);
@@ -78,6 +85,29 @@ std::shared_ptr<KamayanUnit> KamayanUnit::GetFromMesh(MeshData *md,
   return std::static_pointer_cast<KamayanUnit>(pkg);
 }
 
+void KamayanUnit::AddLazyDerived(const std::string &field,
+                                 std::function<TaskStatus(MeshData *md)> fill) {
+  lazy_derived_[field] = LazyDerivedField{fill};
+}
+
+void KamayanUnit::LazyDerivedField::Fill(const std::vector<MeshData *> &partitions,
+                                         const int ncycle) {
+  // nothing has changed since the last output this cycle
+  if (cycle == ncycle) return;
+  for (auto md : partitions) {
+    fill(md);
+  }
+  cycle = ncycle;
+}
+
+void KamayanUnit::FillLazyDerived(MeshData *md, const std::string &field) {
+  for (auto &[name, pkg] : md->GetMeshPointer()->packages.AllPackages()) {
+    if (typeid(*pkg) != typeid(KamayanUnit)) continue;
+    auto &lazy_derived = std::static_pointer_cast<KamayanUnit>(pkg)->LazyDerived();
+    if (lazy_derived.count(field) > 0) lazy_derived.at(field).fill(md);
+  }
+}
+
 void UnitCollection::AddTasks(std::list<std::string> unit_list,
                               std::function<void(KamayanUnit *)> function) const {
   for (const auto &unit : units) {
@@ -94,6 +124,18 @@ void UnitCollection::Add(std::shared_ptr<KamayanUnit> kamayan_unit) {
   units[kamayan_unit->Name()] = kamayan_unit;
 }
 
+void UnitCollection::FillLazyDerived(Mesh *mesh, const int ncycle) const {
+  std::vector<MeshData *> partitions;
+  for (auto &partition : mesh->GetDefaultBlockPartitions()) {
+    partitions.push_back(mesh->mesh_data.Add("base", partition).get());
+  }
+  for (const auto &[name, unit] : units) {
+    for (auto &[field, lazy] : unit->LazyDerived()) {
+      lazy.Fill(partitions, ncycle);
+    }
+  }
+}
+
 UnitCollection ProcessUnits() {
   UnitCollection unit_collection;
   unit_collection["driver"] = driver::ProcessUnit();
@@ -1,6 +1,7 @@
 #ifndef KAMAYAN_UNIT_HPP_
 #define KAMAYAN_UNIT_HPP_
 
+#include <algorithm>
 #include <functional>
 #include <list>
 #include <map>
@@ -78,6 +79,20 @@ struct KamayanUnit : public StateDescriptor,
 
   const std::string Name() const { return name_; }
 
+  // derived fields that are only filled when they are consumed by an output or
+  // refinement criterion, rather than every cycle like FillDerivedMesh
+  struct LazyDerivedField {
+    std::function<TaskStatus(MeshData *md)> fill;
+    // cycle the field was last filled over the whole mesh
+    int cycle = -1;
+
+    // fill over all the partitions of the mesh, unless that was already done in ncycle
+    void Fill(const std::vector<MeshData *> &partitions, const int ncycle);
+  };
+  void AddLazyDerived(const std::string &field,
+                      std::function<TaskStatus(MeshData *md)> fill);
+  auto &LazyDerived() { return lazy_derived_; }
+
   // get a reference to the UnitData configured for a particular block
   const UnitData &Data(const std::string &key) const;
   UnitData &AddData(const std::string &block);
@@ -96,8 +111,11 @@ struct KamayanUnit : public StateDescriptor,
   void SetUnits(std::shared_ptr<const UnitCollection> units);
   const KamayanUnit &GetUnit(const std::string &name) const;
   std::shared_ptr<const KamayanUnit> GetUnitPtr(const std::string &name) const;
+  std::shared_ptr<const UnitCollection> GetUnits() const;
 
   static std::shared_ptr<KamayanUnit> GetFromMesh(MeshData *md, const std::string &name);
+  // fill field over md if it is lazily derived by any unit
+  static void FillLazyDerived(MeshData *md, const std::string &field);
 
   // wrap some methods from the base class to protect around the param_lock_
   template <typename T>
@@ -119,6 +137,7 @@ struct KamayanUnit : public StateDescriptor,
  private:
   std::string name_;
   std::map<std::string, UnitData> unit_data_;
+  std::map<std::string, LazyDerivedField> lazy_derived_;
   std::shared_ptr<Config> config_;
   std::shared_ptr<runtime_parameters::RuntimeParameters> runtime_parameters_;
   std::weak_ptr<const UnitCollection> units_;
@@ -181,6 +200,23 @@ struct UnitCollection {
   std::vector<std::string> BuildExecutionOrder(CallbackGetter getter,
                                                const std::string &callback_name) const;
 
+  /// Replace the callbacks of several units with a single callback on another unit.
+  ///
+  /// The fused callback inherits every dependency that the fused units had on, or
+  /// were given by, units outside of the fusion, so it takes their place in the DAG.
+  ///
+  /// @tparam CallbackGetter Function that extracts the callback registration from a unit
+  /// @param getter Lambda that returns reference to CallbackRegistration from KamayanUnit
+  /// @param owner Name of the unit that will own the fused callback
+  /// @param fused Names of the units whose callbacks are replaced
+  /// @param fn The fused callback
+  /// @param callback_name Name of callback type (for error messages)
+  /// @return Execution order of the fused units that had the callback registered
+  template <typename CallbackGetter, typename Func>
+  std::vector<std::string> FuseCallbacks(CallbackGetter getter, const std::string &owner,
+                                         const std::vector<std::string> &fused, Func fn,
+                                         const std::string &callback_name) const;
+
   /// Write callback dependency graph in GraphViz DOT format.
   ///
   /// @tparam CallbackGetter Function that extracts the callback registration from a unit
@@ -193,6 +229,9 @@ struct UnitCollection {
 
   void Add(std::shared_ptr<KamayanUnit> kamayan_unit);
 
+  // fill all the lazily derived fields over the mesh, at most once per cycle
+  void FillLazyDerived(Mesh *mesh, const int ncycle) const;
+
  private:
   std::map<std::string, std::shared_ptr<KamayanUnit>> units;
 };
@@ -254,6 +293,52 @@ UnitCollection::BuildExecutionOrder(CallbackGetter getter,
   }
 }
 
+template <typename CallbackGetter, typename Func>
+std::vector<std::string>
+UnitCollection::FuseCallbacks(CallbackGetter getter, const std::string &owner,
+                              const std::vector<std::string> &fused, Func fn,
+                              const std::string &callback_name) const {
+  const auto is_fused = [&](const std::string &name) {
+    return std::find(fused.begin(), fused.end(), name) != fused.end();
+  };
+  const auto add_unique = [](std::vector<std::string> &names, const std::string &name) {
+    if (std::find(names.begin(), names.end(), name) == names.end())
+      names.push_back(name);
+  };  // NOLINT(readability/braces)
+
+  std::vector<std::string> order;
+  for (const auto &name : BuildExecutionOrder(getter, callback_name)) {
+    if (is_fused(name)) order.push_back(name);
+  }
+
+  std::vector<std::string> after, before;
+  for (const auto &[name, unit] : units) {
+    auto &registration = getter(unit.get());
+    if (!registration.IsRegistered()) continue;
+    if (is_fused(name)) {
+      for (const auto &dependency : registration.depends_on) {
+        if (!is_fused(dependency) && dependency != owner) add_unique(after, dependency);
+      }
+      for (const auto &dependent : registration.required_by) {
+        if (!is_fused(dependent) && dependent != owner) add_unique(before, dependent);
+      }
+    } else if (name != owner) {
+      for (const auto &dependency : registration.depends_on) {
+        if (is_fused(dependency)) add_unique(before, name);
+      }
+      for (const auto &dependent : registration.required_by) {
+        if (is_fused(dependent)) add_unique(after, name);
+      }
+    }
+  }
+
+  for (const auto &name : order) {
+    getter(Get(name).get()) = nullptr;
+  }
+  getter(Get(owner).get()).Register(fn, after, before);
+  return order;
+}
+
 template <typename CallbackGetter>
 void UnitCollection::WriteCallbackGraph(std::ostream &stream, CallbackGetter getter,
                                         const std::string &callback_name) const {
@@ -0,0 +1,69 @@
+#ifndef KAMAYAN_UTILS_SIMD_HPP_
+#define KAMAYAN_UTILS_SIMD_HPP_
+
+#include <cstddef>
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <basic_types.hpp>
+
+namespace kamayan {
+// simd batch of Reals used for vectorizing loops along contiguous i.
+// Device backends fall back to the scalar abi, so batched kernels
+// reduce to their scalar counterparts there
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) || \
+    defined(KOKKOS_ENABLE_SYCL)
+using SimdReal =
+    Kokkos::Experimental::simd<parthenon::Real, Kokkos::Experimental::simd_abi::scalar>;
+#else
+using SimdReal = Kokkos::Experimental::native_simd<parthenon::Real>;
+#endif
+using SimdMask = SimdReal::mask_type;
+
+constexpr int simd_width = SimdReal::size();
+
+KOKKOS_FORCEINLINE_FUNCTION SimdReal SimdLoad(const parthenon::Real *ptr) {
+  SimdReal v;
+  v.copy_from(ptr, Kokkos::Experimental::element_aligned_tag());
+  return v;
+}
+
+KOKKOS_FORCEINLINE_FUNCTION void SimdStore(const SimdReal &v, parthenon::Real *ptr) {
+  v.copy_to(ptr, Kokkos::Experimental::element_aligned_tag());
+}
+
+// single precision storage is widened on load & narrowed on store
+KOKKOS_FORCEINLINE_FUNCTION SimdReal SimdLoad(const float *ptr) {
+  return SimdReal([=](const std::size_t lane) { return parthenon::Real(ptr[lane]); });
+}
+
+KOKKOS_FORCEINLINE_FUNCTION void SimdStore(const SimdReal &v, float *ptr) {
+  for (std::size_t lane = 0; lane < SimdReal::size(); lane++) {
+    ptr[lane] = static_cast<float>(v[lane]);
+  }
+}
+
+// assignable reference to simd_width contiguous Reals
+struct SimdRef {
+  KOKKOS_FORCEINLINE_FUNCTION explicit SimdRef(parthenon::Real *ptr_) : ptr(ptr_) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION const SimdRef &operator=(const SimdReal &v) const {
+    SimdStore(v, ptr);
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION operator SimdReal() const { return SimdLoad(ptr); }
+
+ private:
+  parthenon::Real *ptr;
+};
+
+// select a where mask is true, otherwise b
+KOKKOS_FORCEINLINE_FUNCTION SimdReal Select(const SimdMask &mask, const SimdReal &a,
+                                            const SimdReal &b) {
+  return Kokkos::Experimental::condition(mask, a, b);
+}
+}  // namespace kamayan
+
+#endif  // KAMAYAN_UTILS_SIMD_HPP_
@@ -29,37 +29,40 @@ struct TypeVarIndexer {
   }
 };
 
-template <typename>
+// fixed size array indexed by the variables in a type list. The value_type
+// defaults to Real, but can also hold simd batches
+template <typename, typename = Real>
 struct TypeListArray {};
 
-template <template <typename...> typename TL, DenseVar... Ts>
-struct TypeListArray<TL<Ts...>> {
+template <template <typename...> typename TL, DenseVar... Ts, typename T>
+struct TypeListArray<TL<Ts...>, T> {
   using indexer = TypeVarIndexer<Ts...>;
   using type = TypeList<Ts...>;
+  using value_type = T;
   static constexpr std::size_t n_vars = (0 + ... + Ts::n_comps);
 
   KOKKOS_INLINE_FUNCTION TypeListArray() = default;
-  KOKKOS_INLINE_FUNCTION TypeListArray(const Real &value) {
+  KOKKOS_INLINE_FUNCTION TypeListArray(const T &value) {
     for (int idx = 0; idx < n_vars; idx++) {
       data[idx] = value;
     }
   }
-  KOKKOS_INLINE_FUNCTION TypeListArray(Kokkos::Array<Real, n_vars> data_) : data(data_) {}
+  KOKKOS_INLINE_FUNCTION TypeListArray(Kokkos::Array<T, n_vars> data_) : data(data_) {}
 
   template <typename V>
-  KOKKOS_INLINE_FUNCTION Real &operator()(const V &var) {
+  KOKKOS_INLINE_FUNCTION T &operator()(const V &var) {
     return data[indexer::Idx(var)];
   }
 
   template <typename V>
-  KOKKOS_INLINE_FUNCTION Real operator()(const V &var) const {
+  KOKKOS_INLINE_FUNCTION T operator()(const V &var) const {
     return data[indexer::Idx(var)];
   }
 
-  KOKKOS_INLINE_FUNCTION Real &operator[](const int &idx) { return data[idx]; }
+  KOKKOS_INLINE_FUNCTION T &operator[](const int &idx) { return data[idx]; }
 
   // private:
-  Kokkos::Array<Real, n_vars> data;
+  Kokkos::Array<T, n_vars> data;
 };
 }  // namespace kamayan
 
@@ -26,8 +26,10 @@
 #include "kamayan_utils/type_abstractions.hpp"
 #include "kamayan_utils/type_list.hpp"
 #include "kokkos_types.hpp"
+#include "physics/hydro/hydro_time_step.hpp"
 #include "physics/hydro/hydro_types.hpp"
 #include "physics/hydro/primconsflux.hpp"
+#include "physics/material_properties/eos/eos_types.hpp"
 
 namespace kamayan::hydro {
 
@@ -66,7 +68,9 @@ void SetupParams(KamayanUnit *unit) {
                                     {"mc", SlopeLimiter::mc}});
   hydro_data.AddParm<RiemannSolver>(
       "riemann", "hll", "Riemann solver used for high order upwinded fluxes.",
-      {{"hll", RiemannSolver::hll}, {"hllc", RiemannSolver::hllc}});
+      {{"hll", RiemannSolver::hll},
+       {"hllc", RiemannSolver::hllc},
+       {"hlld", RiemannSolver::hlld}});
 
   hydro_data.AddParm<ReconstructVars>("ReconstructionVars", "primitive",
                                       "Choice of variables used for reconstruction.",
@@ -76,7 +80,33 @@ void SetupParams(KamayanUnit *unit) {
       "ReconstructionStrategy", "scratchpad",
       "Loop strategy for reconstruction and riemann solve.",
       {{"scratchpad", ReconstructionStrategy::scratchpad},
-       {"scratchvar", ReconstructionStrategy::scratchvar}});
+       {"scratchvar", ReconstructionStrategy::scratchvar},
+       {"fused", ReconstructionStrategy::fused}});
+
+  hydro_data.AddParm<BatchMode>(
+      "batch_mode", "scalar",
+      "Reconstruct & riemann solve pencils cell by cell (scalar) or in simd batches "
+      "of cells along i.",
+      {{"scalar", BatchMode::scalar}, {"simd", BatchMode::simd}});
+
+  hydro_data.AddParm<bool>(
+      "cache_wave_speeds", false,
+      "Cache the cell centered fast (sound) speeds in the eos pass to be shared by the "
+      "timestep & riemann solver, which then bounds its wave speeds with the cell "
+      "centered values on either side of each face. Operator split updates after the "
+      "final stage must call the eos again for the timestep to see fresh speeds.");
+
+  hydro_data.AddParm<bool>(
+      "fuse_timestep", false,
+      "Find the timestep in the eos pass at the end of the final stage rather than a "
+      "separate reduction over the mesh. Changes made by split operators are not "
+      "seen by the timestep.");
+
+  hydro_data.AddParm<FluxPrecision>(
+      "flux_precision", "full",
+      "Precision of the reconstructed riemann states. mixed holds them in single "
+      "precision while fluxes and updates stay in double.",
+      {{"full", FluxPrecision::full}, {"mixed", FluxPrecision::mixed}});
 
   // --8<-- [start:add_parm]
   // since EMFAveraging was declared with the POLYMORPHIC_PARM macro
@@ -104,6 +134,11 @@ struct InitializeHydro {
     // primitive variables reference same data on each multi-stage buffer
     AddFields(typename hydro_vars::NonFlux(), unit, {CENTER_FLAGS()});
     // --8<-- [end:hydro_add_fields]
+    if (unit->Data("hydro").Get<bool>("cache_wave_speeds")) {
+      // speeds are needed on the faces of the ghost cells
+      AddField<CFAST>(unit, {Metadata::Cell, Metadata::FillGhost},
+                      {hydro_vars::MHD == Mhd::off ? 1 : 3});
+    }
     if constexpr (hydro_vars::MHD == Mhd::ct) {
       auto m = Metadata(std::vector<MetadataFlag>{
           FACE_FLAGS(Metadata::Independent, Metadata::WithFluxes)});
@@ -126,14 +161,18 @@ struct InitializeHydro {
       // This really should include all mass scalars
       constexpr int nrecon = count_components(reconstruct_vars());
 
-      auto nspecies =
-          static_cast<int>(unit->GetUnit("material").Param<std::size_t>("nspecies"));
-      nspecies = nspecies > 1 ? nspecies : 0;
+      int nspecies = 0;
+      if constexpr (hydro_vars::SPECIES == Species::multi) {
+        nspecies =
+            static_cast<int>(unit->GetUnit("material").Param<std::size_t>("nspecies"));
+      }
+      // --8<-- [start:addscratch]
       riemann_scratch.template RegisterShape<RS::Minus>({nrecon + nspecies});
       riemann_scratch.template RegisterShape<RS::Plus>({nrecon + nspecies});
 
       unit->AddParam("riemann_scratch", riemann_scratch);
       AddScratch(riemann_scratch, unit);
+      // --8<-- [end:addscratch]
     }
   }
 };
@@ -144,7 +183,13 @@ void InitializeData(KamayanUnit *unit) {
   Dispatcher<InitializeHydro>(PARTHENON_AUTO_LABEL, cfg.get()).execute(unit, cfg.get());
 
   unit->EstimateTimestepMesh = EstimateTimeStepMesh;
-  unit->FillDerivedMesh = FillDerived;
+  if (unit->Data("hydro").Get<bool>("fuse_timestep")) {
+    unit->AddParam("fused_timesteps", std::make_shared<FusedTimeSteps>());
+    unit->AddParam("fused_timestep_hook",
+                   eos::FusedTimeStepHook{FuseTimeStep, SetFusedTimeStep});
+  }
+  // divb is only needed for outputs & diagnostics
+  if (cfg->Get<Mhd>() == Mhd::ct) unit->AddLazyDerived(DIVB::name(), FillDerived);
 }
 
 struct FillDerived_impl {
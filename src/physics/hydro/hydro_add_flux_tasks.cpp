@@ -21,6 +21,7 @@
 #include "physics/hydro/hydro.hpp"
 #include "physics/hydro/hydro_types.hpp"
 #include "physics/hydro/reconstruction.hpp"
+#include "physics/hydro/reconstruction_simd.hpp"
 #include "physics/hydro/riemann_solver.hpp"
 #include "physics/physics_types.hpp"
 
@@ -46,10 +47,12 @@ struct CalculateFluxesNested {
                                                typename hydro_traits::MassScalars>;
     // --8<-- [start:pack]
     auto pack_recon = grid::GetPack(reconstruct_vars(), md);
-    // include Xf for cylindrical geometry flux corrections
-    using flux_vars = ConcatTypeLists_t<conserved_vars, grid::Xface>;
+    // include Xf for cylindrical geometry flux corrections & any cached wave speeds
+    using flux_vars = ConcatTypeLists_t<conserved_vars, grid::Xface, TypeList<CFAST>>;
     auto pack_flux = grid::GetPack(flux_vars(), md, {PDOpt::WithFluxes});
     // --8<-- [end:pack]
+    const bool cached_speeds = md->GetMeshPointer()->packages.Get("hydro")->Param<bool>(
+        "hydro/cache_wave_speeds");
 
     const int ndim = md->GetNDim();
     const int nblocks = pack_recon.GetNBlocks();
@@ -73,8 +76,11 @@ struct CalculateFluxesNested {
     const int nxb = pmb->cellbounds.ncellsi(IndexDomain::entire);
 
     const int scratch_level = 1;  // 0 small
+    constexpr auto batch = reconstruction_traits::batch;
+    using StatePad = parthenon::ScratchPad2D<typename reconstruction_traits::state_t>;
+    // packs only hold the species allocated on the partition
     const int nrecon = pack_recon.GetMaxNumberOfVars();
-    size_t pencil_scratch_size_in_bytes = ScratchPad2D::shmem_size(nrecon, nxb);
+    size_t pencil_scratch_size_in_bytes = StatePad::shmem_size(nrecon, nxb);
 
     parthenon::par_for_outer(
         PARTHENON_AUTO_LABEL, 2 * pencil_scratch_size_in_bytes, scratch_level, 0,
@@ -82,57 +88,28 @@ struct CalculateFluxesNested {
         KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int b, const int k,
                       const int j) {
           // holds reconstructed vars at i - 1/2
-          ScratchPad2D vM(member.team_scratch(scratch_level), nrecon, nxb);
+          StatePad vM(member.team_scratch(scratch_level), nrecon, nxb);
           // holds reconstructed vars at i + 1/2
-          ScratchPad2D vP(member.team_scratch(scratch_level), nrecon, nxb);
+          StatePad vP(member.team_scratch(scratch_level), nrecon, nxb);
+          // only the species allocated on this block are reconstructed
+          const int nvars = pack_recon.GetUpperBound(b) + 1;
 
           // --8<-- [start:rea]
-          parthenon::par_for_inner(
-              member, 0, nrecon - 1, ib.s - 1, ib.e + 1, [&](const int var, const int i) {
+          ReconstructPencil<reconstruction_traits>(
+              member, nvars, ib.s - 1, ib.e + 1,
+              [&](const int var, const int i) {
                 // --8<-- [start:make-stncl]
-                auto stencil = SubPack<Axis::IAXIS>(pack_recon, b, var, k, j, i);
-                Reconstruct<reconstruction_traits>(stencil, vM(var, i), vP(var, i));
+                return SubPack<Axis::IAXIS>(pack_recon, b, var, k, j, i);
                 // --8<-- [end:make-stncl]
-              });
+              },
+              vM, vP);
 
           member.team_barrier();
-          parthenon::par_for_inner(member, ib.s, ib.e + 1, [&](const int i) {
-            // riemann solve
-            auto vL = MakeScratchIndexer(pack_recon, vP, b, i - 1);
-            auto vR = MakeScratchIndexer(pack_recon, vM, b, i);
-            auto pack_indexer = SubPack(pack_flux, b, k, j, i);
-            if constexpr (hydro_traits::MHD == Mhd::ct) {
-              vL(MAGC(0)) = pack_indexer(TE::F1, MAG());
-              vR(MAGC(0)) = pack_indexer(TE::F1, MAG());
-            }
-            RiemannFlux<TE::F1, riemann, hydro_traits>(pack_indexer, vL, vR);
-            if constexpr (geom == Geometry::cylindrical) {
-              auto cpack =
-                  grid::CoordinatePack<Geometry::cylindrical, grid::Xface>(pack_flux, b);
-              pack_flux.flux(b, TE::F1, MOMENTUM(2), k, j, i) *=
-                  cpack.Xf<Axis::IAXIS>(k, j, i);
-              if constexpr (hydro_traits::MHD == Mhd::ct) {
-                pack_flux.flux(b, TE::F1, MAGC(2), k, j, i) *=
-                    utils::Ratio(1.0, cpack.Xf<Axis::IAXIS>(k, j, i));
-              }
-            }
-          });
+          // riemann solve
+          RiemannPencil<TE::F1, riemann, hydro_traits, geom, batch>(
+              member, pack_recon, pack_flux, vP, vM, b, k, j, ib.s, ib.e + 1,
+              cached_speeds);
           // --8<-- [end:rea]
-
-          member.team_barrier();
-          type_for(typename hydro_traits::MassScalars(), [&]<typename V>(const V &v) {
-            int offset = count_components(typename hydro_traits::Reconstruct());
-            for (int s = 0; s <= pack_flux.GetUpperBound(b, V()); s++) {
-              par_for_inner(member, ib.s, ib.e + 1, [&](const int i) {
-                const auto rho_flux = pack_flux.flux(b, TE::F1, DENS(), k, j, i);
-
-                pack_flux.flux(b, TE::F1, V(s), k, j, i) =
-                    rho_flux > 0.0 ? rho_flux * vP(offset + s, i - 1)
-                                   : rho_flux * vM(offset + s, i);
-              });
-            }
-            offset++;
-          });
         });
 
     if (ndim > 1) {
@@ -145,54 +122,27 @@ struct CalculateFluxesNested {
             // at the face j-1/2 we can use
             //   * vL = vP_{j-1}
             //   * vR = vM_{j}
-            ScratchPad2D vMP(member.team_scratch(scratch_level), nrecon, nxb);
-            ScratchPad2D vM(member.team_scratch(scratch_level), nrecon, nxb);
-            ScratchPad2D vP(member.team_scratch(scratch_level), nrecon, nxb);
+            StatePad vMP(member.team_scratch(scratch_level), nrecon, nxb);
+            StatePad vM(member.team_scratch(scratch_level), nrecon, nxb);
+            StatePad vP(member.team_scratch(scratch_level), nrecon, nxb);
+            const int nvars = pack_recon.GetUpperBound(b) + 1;
             // loop over flux pencils at j - 1/2
             for (int j = jb.s - 1; j <= jb.e + 1; j++) {
-              parthenon::par_for_inner(
-                  member, 0, nrecon - 1, ib.s, ib.e, [&](const int var, const int i) {
-                    auto stencil = SubPack<Axis::JAXIS>(pack_recon, b, var, k, j, i);
-                    Reconstruct<reconstruction_traits>(stencil, vM(var, i), vP(var, i));
-                  });
+              ReconstructPencil<reconstruction_traits>(
+                  member, nvars, ib.s, ib.e,
+                  [&](const int var, const int i) {
+                    return SubPack<Axis::JAXIS>(pack_recon, b, var, k, j, i);
+                  },
+                  vM, vP);
               member.team_barrier();
               // first iteration we don't calculate fluxes, it was just for the
               // reconstruction
               if (j > jb.s - 1) {
-                parthenon::par_for_inner(member, ib.s, ib.e, [&](const int i) {
-                  // riemann solver
-                  auto vL = MakeScratchIndexer(pack_recon, vMP, b, i);
-                  auto vR = MakeScratchIndexer(pack_recon, vM, b, i);
-                  auto pack_indexer = SubPack(pack_flux, b, k, j, i);
-                  if constexpr (hydro_traits::MHD == Mhd::ct) {
-                    vL(MAGC(1)) = pack_indexer(TE::F2, MAG());
-                    vR(MAGC(1)) = pack_indexer(TE::F2, MAG());
-                  }
-                  RiemannFlux<TE::F2, riemann, hydro_traits>(pack_indexer, vL, vR);
-                  if constexpr (hydro_traits::MHD == Mhd::ct &&
-                                geom == Geometry::cylindrical) {
-                    auto cpack = grid::CoordinatePack<Geometry::cylindrical, grid::Xface>(
-                        pack_flux, b);
-                    pack_flux.flux(b, TE::F2, MAGC(2), k, j, i) *=
-                        utils::Ratio(1.0, cpack.Xf<Axis::JAXIS>(k, j, i));
-                  }
-                });
-
+                // riemann solver
+                RiemannPencil<TE::F2, riemann, hydro_traits, geom, batch>(
+                    member, pack_recon, pack_flux, vMP, vM, b, k, j, ib.s, ib.e,
+                    cached_speeds);
                 member.team_barrier();
-                type_for(typename hydro_traits::MassScalars(), [&]<typename V>(
-                                                                   const V &v) {
-                  int offset = count_components(typename hydro_traits::Reconstruct());
-                  for (int s = 0; s < pack_flux.GetUpperBound(b, V()); s++) {
-                    par_for_inner(member, ib.s, ib.e, [&](const int i) {
-                      const auto rho_flux = pack_flux.flux(b, TE::F2, DENS(), k, j, i);
-
-                      pack_flux.flux(b, TE::F2, V(s), k, j, i) =
-                          rho_flux > 0.0 ? rho_flux * vMP(offset + s, i)
-                                         : rho_flux * vM(offset + s, i);
-                    });
-                  }
-                  offset++;
-                });
               }
 
               auto *tmp = vMP.data();
@@ -212,46 +162,26 @@ struct CalculateFluxesNested {
             // at the face k-1/2 we can use
             //   * vL = vP_{k-1} = vMP (v-minus-plus, vP from the previous iteration)
             //   * vR = vM_{k} = vM
-            ScratchPad2D vMP(member.team_scratch(scratch_level), nrecon, nxb);
-            ScratchPad2D vM(member.team_scratch(scratch_level), nrecon, nxb);
-            ScratchPad2D vP(member.team_scratch(scratch_level), nrecon, nxb);
+            StatePad vMP(member.team_scratch(scratch_level), nrecon, nxb);
+            StatePad vM(member.team_scratch(scratch_level), nrecon, nxb);
+            StatePad vP(member.team_scratch(scratch_level), nrecon, nxb);
+            const int nvars = pack_recon.GetUpperBound(b) + 1;
             // loop over flux pencils at k - 1/2
             for (int k = kb.s - 1; k <= kb.e + 1; k++) {
-              parthenon::par_for_inner(
-                  member, 0, nrecon - 1, ib.s, ib.e, [&](const int var, const int i) {
-                    auto stencil = SubPack<Axis::KAXIS>(pack_recon, b, var, k, j, i);
-                    Reconstruct<reconstruction_traits>(stencil, vM(var, i), vP(var, i));
-                  });
+              ReconstructPencil<reconstruction_traits>(
+                  member, nvars, ib.s, ib.e,
+                  [&](const int var, const int i) {
+                    return SubPack<Axis::KAXIS>(pack_recon, b, var, k, j, i);
+                  },
+                  vM, vP);
               member.team_barrier();
 
               if (k > kb.s - 1) {
-                parthenon::par_for_inner(member, ib.s, ib.e, [&](const int i) {
-                  // riemann solve
-                  auto vL = MakeScratchIndexer(pack_recon, vMP, b, i);
-                  auto vR = MakeScratchIndexer(pack_recon, vM, b, i);
-                  auto pack_indexer = SubPack(pack_flux, b, k, j, i);
-                  if constexpr (hydro_traits::MHD == Mhd::ct) {
-                    vL(MAGC(2)) = pack_indexer(TE::F3, MAG());
-                    vR(MAGC(2)) = pack_indexer(TE::F3, MAG());
-                  }
-                  RiemannFlux<TE::F3, riemann, hydro_traits>(pack_indexer, vL, vR);
-                });
+                // riemann solve
+                RiemannPencil<TE::F3, riemann, hydro_traits, geom, batch>(
+                    member, pack_recon, pack_flux, vMP, vM, b, k, j, ib.s, ib.e,
+                    cached_speeds);
                 member.team_barrier();
-
-                type_for(typename hydro_traits::MassScalars(), [&]<typename V>(
-                                                                   const V &v) {
-                  int offset = count_components(typename hydro_traits::Reconstruct());
-                  for (int s = 0; s < pack_flux.GetUpperBound(b, V()); s++) {
-                    par_for_inner(member, ib.s, ib.e + 1, [&](const int i) {
-                      const auto rho_flux = pack_flux.flux(b, TE::F3, DENS(), k, j, i);
-
-                      pack_flux.flux(b, TE::F3, V(s), k, j, i) =
-                          rho_flux > 0.0 ? rho_flux * vMP(offset + s, i)
-                                         : rho_flux * vM(offset + s, i);
-                    });
-                  }
-                  offset++;
-                });
               }
               auto *tmp = vMP.data();
               vMP.assign_data(vP.data());
@@ -282,11 +212,12 @@ struct CalculateFluxesScratch {
     using plus = RiemannScratch::Plus;
 
     auto pack_recon = grid::GetPack(reconstruct_vars(), md);
-    using flux_vars = ConcatTypeLists_t<conserved_vars, grid::Xface>;
+    using flux_vars = ConcatTypeLists_t<conserved_vars, grid::Xface, TypeList<CFAST>>;
     auto pack_flux = grid::GetPack(flux_vars(), md, {PDOpt::WithFluxes});
 
     auto hydro = md->GetMeshPointer()->packages.Get("hydro");
     const auto riemann_scratch = hydro->Param<RiemannScratch::type>("riemann_scratch");
+    const bool cached_speeds = hydro->Param<bool>("hydro/cache_wave_speeds");
     auto pack_scratch = ScratchPack(md, riemann_scratch);
 
     const int ndim = md->GetNDim();
@@ -336,16 +267,29 @@ struct CalculateFluxesScratch {
       par_for(
           PARTHENON_AUTO_LABEL, 0, nblocks - 1, kb.s, pad_kb.e, jb.s, pad_jb.e, ib.s,
           pad_ib.e, KOKKOS_LAMBDA(const int b, const int k, const int j, const int i) {
+            // --8<-- [start:use-scratch]
             auto vL = pack_scratch.Indexer(plus(), reconstruct_vars(), b, k - kk, j - jj,
                                            i - ii);
             auto vR = pack_scratch.Indexer(minus(), reconstruct_vars(), b, k, j, i);
+            // --8<-- [end:use-scratch]
 
             auto pack_indexer = SubPack(pack_flux, b, k, j, i);
             if constexpr (hydro_traits::MHD == Mhd::ct) {
               vL(MAGC(dir)) = pack_indexer(face, MAG());
               vR(MAGC(dir)) = pack_indexer(face, MAG());
             }
-            RiemannFlux<face, riemann, hydro_traits>(pack_indexer, vL, vR);
+            if (cached_speeds) {
+              constexpr int cdir = hydro_traits::MHD == Mhd::off ? 0 : dir;
+              const Real cL = pack_flux(b, CFAST(cdir), k - kk, j - jj, i - ii);
+              const Real cR = pack_flux(b, CFAST(cdir), k, j, i);
+              RiemannFlux<face, riemann, hydro_traits>(
+                  pack_indexer, FastSpeedState(vL, cL), FastSpeedState(vR, cR));
+            } else {
+              RiemannFlux<face, riemann, hydro_traits>(pack_indexer, vL, vR);
+            }
+            if constexpr (hydro_traits::SPECIES == Species::multi) {
+              UpwindMassScalars<face, hydro_traits>(pack_indexer, vL, vR);
+            }
             if constexpr (hydro_traits::MHD == Mhd::ct && geom == Geometry::cylindrical) {
               auto cpack =
                   grid::CoordinatePack<Geometry::cylindrical, grid::Xface>(pack_flux, b);
@@ -356,24 +300,6 @@ struct CalculateFluxesScratch {
                   utils::Ratio(1.0, cpack.Xf(ax, k, j, i));
             }
           });
-
-      par_for_outer(
-          PARTHENON_AUTO_LABEL, 0, 0, 0, nblocks - 1, kb.s, pad_kb.e, jb.s, pad_jb.e,
-          KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int b, const int k,
-                        const int j) {
-            const int offset = count_components(typename hydro_traits::Reconstruct());
-            par_for_inner(
-                member, offset, pack_recon.GetUpperBound(b), ib.s, pad_ib.e,
-                [&](const int &var, const int &i) {
-                  const auto rho_flux = pack_flux.flux(b, face, DENS(), k, j, i);
-                  const int ms_idx =
-                      var - offset + count_components(typename hydro_traits::Conserved());
-                  pack_flux.flux(b, face, ms_idx, k, j, i) =
-                      rho_flux > 0.0
-                          ? rho_flux * pack_scratch(b, plus(var), k - kk, j - jj, i - ii)
-                          : rho_flux * pack_scratch(b, minus(var), k, j, i);
-                });
-          });
     };  // NOLINT(readability/braces)
 
     calc_fluxes.template operator()<Axis::IAXIS>();
@@ -384,6 +310,159 @@ struct CalculateFluxesScratch {
   }
 };
 
+// Unsplit flux calculation where a single team handles all the faces of a (k, j)
+// plane of the block. The reconstructed variables on the plane are loaded into a
+// tile in scratch once, and both the I & J sweeps are reconstructed out of the tile.
+// The K sweep reads its out of plane stencil directly from the pack.
+struct CalculateFluxesFused {
+  using options = OptTypeList<HydroFactory, ReconstructionFactory, RiemannOptions,
+                              grid::GeometryOptions>;
+  using value = TaskStatus;
+
+  using TE = TopologicalElement;
+
+  template <HydroTrait hydro_traits, ReconstructTrait reconstruction_traits,
+            RiemannSolver riemann, Geometry geom>
+  requires(NonTypeTemplateSpecialization<hydro_traits, HydroTraits>)
+  value dispatch(MeshData *md) {
+    using conserved_vars = ConcatTypeLists_t<typename hydro_traits::Conserved,
+                                             typename hydro_traits::MassScalars>;
+    using reconstruct_vars = ConcatTypeLists_t<typename hydro_traits::Reconstruct,
+                                               typename hydro_traits::MassScalars>;
+    auto pack_recon = grid::GetPack(reconstruct_vars(), md);
+    using flux_vars = ConcatTypeLists_t<conserved_vars, grid::Xface, TypeList<CFAST>>;
+    auto pack_flux = grid::GetPack(flux_vars(), md, {PDOpt::WithFluxes});
+    const bool cached_speeds = md->GetMeshPointer()->packages.Get("hydro")->Param<bool>(
+        "hydro/cache_wave_speeds");
+
+    const int ndim = md->GetNDim();
+    const int nblocks = pack_recon.GetNBlocks();
+    auto ib = md->GetBoundsI(IndexDomain::interior);
+    auto jb = md->GetBoundsJ(IndexDomain::interior);
+    auto kb = md->GetBoundsK(IndexDomain::interior);
+    if constexpr (hydro_traits::MHD == Mhd::ct) {
+      // need fluxes along additional dimension for edge emfs
+      const int k1d = ndim > 1 ? 1 : 0;
+      const int k2d = ndim > 1 ? 1 : 0;
+      const int k3d = ndim > 2 ? 1 : 0;
+      ib.s -= k1d;
+      ib.e += k1d;
+      jb.s -= k2d;
+      jb.e += k2d;
+      kb.s -= k3d;
+      kb.e += k3d;
+    }
+
+    auto pmb = md->GetBlockData(0)->GetBlockPointer();
+    const int nxi = pmb->cellbounds.ncellsi(IndexDomain::entire);
+    const int nxj = pmb->cellbounds.ncellsj(IndexDomain::entire);
+
+    const int scratch_level = 1;
+    constexpr auto batch = reconstruction_traits::batch;
+    using StatePad = parthenon::ScratchPad2D<typename reconstruction_traits::state_t>;
+    // packs only hold the species allocated on the partition
+    const int nrecon = pack_recon.GetMaxNumberOfVars();
+    const size_t tile_scratch_size_in_bytes = ScratchPad3D::shmem_size(nrecon, nxj, nxi);
+    const size_t pencil_scratch_size_in_bytes = StatePad::shmem_size(nrecon, nxi);
+    const size_t scratch_size_in_bytes =
+        tile_scratch_size_in_bytes + 4 * pencil_scratch_size_in_bytes;
+
+    // the extra row of j is only used to seed the first j - 1/2 face
+    const int js = ndim > 1 ? jb.s - 1 : jb.s;
+    const int je = ndim > 1 ? jb.e + 1 : jb.e;
+    // the extra plane of teams only computes the k + 1/2 faces on the block boundary
+    const int ke = ndim > 2 ? kb.e + 1 : kb.e;
+
+    parthenon::par_for_outer(
+        PARTHENON_AUTO_LABEL, scratch_size_in_bytes, scratch_level, 0, nblocks - 1, kb.s,
+        ke,
+        KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int b, const int k) {
+          ScratchPad3D tile(member.team_scratch(scratch_level), nrecon, nxj, nxi);
+          // vMP holds vP from the previous row of j for the j - 1/2 faces
+          StatePad vMP(member.team_scratch(scratch_level), nrecon, nxi);
+          StatePad vM(member.team_scratch(scratch_level), nrecon, nxi);
+          StatePad vP(member.team_scratch(scratch_level), nrecon, nxi);
+          StatePad vK(member.team_scratch(scratch_level), nrecon, nxi);
+          // only the species allocated on this block are reconstructed
+          const int nvars = pack_recon.GetUpperBound(b) + 1;
+
+          const bool in_plane = k <= kb.e;
+          if (in_plane) {
+            parthenon::par_for_inner(member, 0, nvars - 1, 0, nxj - 1, 0, nxi - 1,
+                                     [&](const int var, const int j, const int i) {
+                                       tile(var, j, i) = pack_recon(b, var, k, j, i);
+                                     });
+            member.team_barrier();
+          }
+
+          for (int j = js; j <= je; j++) {
+            const bool interior_row = j >= jb.s && j <= jb.e;
+            if (in_plane && interior_row) {
+              ReconstructPencil<reconstruction_traits>(
+                  member, nvars, ib.s - 1, ib.e + 1,
+                  [&](const int var, const int i) {
+                    return MakeScratchStencil1D<Axis::IAXIS>(tile, var, j, i);
+                  },
+                  vM, vP);
+              member.team_barrier();
+
+              RiemannPencil<TE::F1, riemann, hydro_traits, geom, batch>(
+                  member, pack_recon, pack_flux, vP, vM, b, k, j, ib.s, ib.e + 1,
+                  cached_speeds);
+              member.team_barrier();
+            }
+
+            if (ndim > 2 && interior_row) {
+              // faces at k - 1/2 use vP_{k-1} and vM_{k}, vK holds the unused states
+              ReconstructPencil<reconstruction_traits>(
+                  member, nvars, ib.s, ib.e,
+                  [&](const int var, const int i) {
+                    return SubPack<Axis::KAXIS>(pack_recon, b, var, k - 1, j, i);
+                  },
+                  vK, vP);
+              member.team_barrier();
+              ReconstructPencil<reconstruction_traits>(
+                  member, nvars, ib.s, ib.e,
+                  [&](const int var, const int i) {
+                    return SubPack<Axis::KAXIS>(pack_recon, b, var, k, j, i);
+                  },
+                  vM, vK);
+              member.team_barrier();
+
+              RiemannPencil<TE::F3, riemann, hydro_traits, geom, batch>(
+                  member, pack_recon, pack_flux, vP, vM, b, k, j, ib.s, ib.e,
+                  cached_speeds);
+              member.team_barrier();
+            }
+
+            if (ndim > 1 && in_plane) {
+              ReconstructPencil<reconstruction_traits>(
+                  member, nvars, ib.s, ib.e,
+                  [&](const int var, const int i) {
+                    return MakeScratchStencil1D<Axis::JAXIS>(tile, var, j, i);
+                  },
+                  vM, vP);
+              member.team_barrier();
+
+              // first row is only for the reconstruction
+              if (j > js) {
+                RiemannPencil<TE::F2, riemann, hydro_traits, geom, batch>(
+                    member, pack_recon, pack_flux, vMP, vM, b, k, j, ib.s, ib.e,
+                    cached_speeds);
+              }
+              member.team_barrier();
+
+              auto *tmp = vMP.data();
+              vMP.assign_data(vP.data());
+              vP.assign_data(tmp);
+            }
+          }
+        });
+
+    return TaskStatus::complete;
+  }
+};
+
 template <TopologicalElement edge, EMFAveraging emf_averaging, Geometry geom,
           typename stencil_2d>
 requires(EdgeElement<edge> && emf_averaging == EMFAveraging::arithmetic)
@@ -456,6 +535,13 @@ TaskID AddFluxTasks(TaskID prev, TaskList &tl, MeshData *md) {
         },
         md, cfg.get());
     // --8<-- [end:add_task]
+  } else if (cfg->Get<ReconstructionStrategy>() == ReconstructionStrategy::fused) {
+    get_fluxes = tl.AddTask(
+        prev, "hydro::CalculateFluxes",
+        [](MeshData *md, Config *cfg) {
+          return Dispatcher<CalculateFluxesFused>(PARTHENON_AUTO_LABEL, cfg).execute(md);
+        },
+        md, cfg.get());
   } else {
     get_fluxes = tl.AddTask(
         prev, "hydro::CalculateFluxes",
@@ -1,3 +1,7 @@
+#include <memory>
+#include <mutex>
+#include <optional>
+
 #include <Kokkos_MinMax.hpp>
 
 #include "dispatcher/options.hpp"
@@ -11,6 +15,7 @@
 #include "kamayan_utils/type_abstractions.hpp"
 #include "kamayan_utils/type_list.hpp"
 #include "physics/hydro/hydro.hpp"
+#include "physics/hydro/hydro_time_step.hpp"
 #include "physics/hydro/hydro_types.hpp"
 #include "physics/hydro/primconsflux.hpp"
 
@@ -23,7 +28,8 @@ struct EstimateTimeStep {
   template <typename hydro_traits>
   requires(NonTypeTemplateSpecialization<hydro_traits, HydroTraits>)
   value dispatch(MeshData *md) {
-    using vars = ConcatTypeLists_t<typename hydro_traits::ConsPrim, grid::CoordFields>;
+    using vars = ConcatTypeLists_t<typename hydro_traits::ConsPrim, grid::CoordFields,
+                                   TypeList<CFAST>>;
 
     auto pack = grid::GetPack(vars(), md);
     const int ndim = md->GetNDim();
@@ -32,6 +38,7 @@ struct EstimateTimeStep {
     auto hydro = md->GetMeshPointer()->packages.Get("hydro");
     const auto cfl = hydro->Param<Real>("hydro/cfl") / static_cast<Real>(ndim);
     // --8<-- [end:get_param]
+    const bool cached_speeds = hydro->Param<bool>("hydro/cache_wave_speeds");
     const int nblocks = pack.GetNBlocks();
     auto ib = md->GetBoundsI(IndexDomain::interior);
     auto jb = md->GetBoundsJ(IndexDomain::interior);
@@ -47,24 +54,57 @@ struct EstimateTimeStep {
           auto V = SubPack(pack, b, k, j, i);
 
           const auto coords = grid::GenericCoordinatePack(geometry, pack, b);
-          for (int dir = 0; dir < ndim; dir++) {
-            const Real cfast = FastSpeed<hydro_traits::MHD>(dir, V);
-            dt_local = Kokkos::min(dt_local, coords.Dx(AxisFromInt(dir + 1), k, j, i) /
-                                                 (Kokkos::abs(V(VELOCITY(dir))) + cfast));
-          }
-
-          if (geometry == Geometry::cylindrical) {
-            dt_local =
-                Kokkos::min(dt_local, coords.template X<Axis::IAXIS>(k, j, i) /
-                                          Kokkos::abs(pack(b, VELOCITY(2), k, j, i)));
-          }
+          dt_local = Kokkos::min(
+              dt_local, CellTimeStep<hydro_traits::MHD>(
+                            V, coords, ndim, geometry == Geometry::cylindrical,
+                            cached_speeds, k, j, i));
         },
         Kokkos::Min<Real>(dt_min));
     return dt_min * cfl;
   }
 };
 
+void FusedTimeSteps::Set(const MeshData *md, const Real dt) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  dt_[md] = dt;
+}
+
+std::optional<Real> FusedTimeSteps::Take(const MeshData *md) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto node = dt_.extract(md);
+  if (node.empty()) return std::nullopt;
+  return node.mapped();
+}
+
+bool FuseTimeStep(MeshData *md) {
+  auto &packages = md->GetMeshPointer()->packages;
+  return packages.Get("hydro")->Param<bool>("hydro/fuse_timestep") &&
+         packages.Get("driver")->Param<bool>("final_stage");
+}
+
+void SetFusedTimeStep(MeshData *md, const Real dt) {
+  auto hydro = md->GetMeshPointer()->packages.Get("hydro");
+  hydro->Param<std::shared_ptr<FusedTimeSteps>>("fused_timesteps")->Set(md, dt);
+}
+
 Real EstimateTimeStepMesh(MeshData *md) {
+  auto hydro = md->GetMeshPointer()->packages.Get("hydro");
+  if (hydro->Param<bool>("hydro/fuse_timestep")) {
+    // found by the eos at the end of the final stage, otherwise we are initializing
+    auto fused_timesteps =
+        hydro->Param<std::shared_ptr<FusedTimeSteps>>("fused_timesteps");
+    auto fused = fused_timesteps->Take(md);
+    // so a fused run can't silently fall back to the separate reduction
+    const bool final_stage =
+        md->GetMeshPointer()->packages.Get("driver")->Param<bool>("final_stage");
+    PARTHENON_REQUIRE_THROWS(
+        fused || !final_stage,
+        "hydro/fuse_timestep is set, but the final stage eos pass found no timestep");
+    if (fused) {
+      return *fused * hydro->Param<Real>("hydro/cfl") / static_cast<Real>(md->GetNDim());
+    }
+  }
+
   auto cfg = GetConfig(md);
   return Dispatcher<EstimateTimeStep>(PARTHENON_AUTO_LABEL, cfg.get()).execute(md);
 }
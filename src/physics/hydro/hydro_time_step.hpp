@@ -0,0 +1,58 @@
+#ifndef PHYSICS_HYDRO_HYDRO_TIME_STEP_HPP_
+#define PHYSICS_HYDRO_HYDRO_TIME_STEP_HPP_
+
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+
+#include <Kokkos_Core.hpp>
+
+#include "grid/grid_types.hpp"
+#include "kamayan/fields.hpp"
+#include "physics/hydro/hydro_types.hpp"
+#include "physics/hydro/primconsflux.hpp"
+
+namespace kamayan::hydro {
+
+// timestep allowed by the signal speeds of a single cell, before the cfl number
+template <Mhd mhd, typename Prim, typename Coords>
+KOKKOS_INLINE_FUNCTION Real CellTimeStep(const Prim &V, const Coords &coords,
+                                         const int ndim, const bool cylindrical,
+                                         const bool cached_speeds, const int k,
+                                         const int j, const int i) {
+  Real dt = std::numeric_limits<Real>::max();
+  for (int dir = 0; dir < ndim; dir++) {
+    const Real cfast = cached_speeds ? V(CFAST(mhd == Mhd::off ? 0 : dir))
+                                     : FastSpeed<mhd>(dir, V);
+    dt = Kokkos::min(dt, coords.Dx(AxisFromInt(dir + 1), k, j, i) /
+                             (Kokkos::abs(V(VELOCITY(dir))) + cfast));
+  }
+
+  if (cylindrical) {
+    dt = Kokkos::min(dt, coords.template X<Axis::IAXIS>(k, j, i) /
+                             Kokkos::abs(V(VELOCITY(2))));
+  }
+  return dt;
+}
+
+// minimum timestep of each partition found by the final stage eos pass, which
+// replaces the reduction over the mesh when hydro/fuse_timestep is set
+class FusedTimeSteps {
+ public:
+  void Set(const MeshData *md, const Real dt);
+  // each timestep is only used once, so they can't go stale across remeshing
+  std::optional<Real> Take(const MeshData *md);
+
+ private:
+  std::mutex mutex_;
+  std::map<const MeshData *, Real> dt_;
+};
+
+// should the eos pass over md also find the timestep
+bool FuseTimeStep(MeshData *md);
+void SetFusedTimeStep(MeshData *md, const Real dt);
+
+}  // namespace kamayan::hydro
+
+#endif  // PHYSICS_HYDRO_HYDRO_TIME_STEP_HPP_
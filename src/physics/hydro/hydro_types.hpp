@@ -2,6 +2,7 @@
 #define PHYSICS_HYDRO_HYDRO_TYPES_HPP_
 
 #include <concepts>
+#include <type_traits>
 
 #include "dispatcher/dispatcher.hpp"
 #include "dispatcher/options.hpp"
@@ -19,7 +20,9 @@ POLYMORPHIC_PARM(Reconstruction, fog, plm, ppm, wenoz);
 POLYMORPHIC_PARM(SlopeLimiter, minmod, van_leer, mc);
 POLYMORPHIC_PARM(RiemannSolver, hll, hllc, hlld);
 POLYMORPHIC_PARM(ReconstructVars, primitive);
-POLYMORPHIC_PARM(ReconstructionStrategy, scratchpad, scratchvar);
+POLYMORPHIC_PARM(ReconstructionStrategy, scratchpad, scratchvar, fused);
+POLYMORPHIC_PARM(BatchMode, scalar, simd);
+POLYMORPHIC_PARM(FluxPrecision, full, mixed);
 // MHD
 POLYMORPHIC_PARM(EMFAveraging, arithmetic);
 }  // namespace kamayan
@@ -30,10 +33,15 @@ using ReconstructionOptions =
             Reconstruction::wenoz>;
 using SlopeLimiterOptions =
     OptList<SlopeLimiter, SlopeLimiter::minmod, SlopeLimiter::van_leer, SlopeLimiter::mc>;
-using RiemannOptions = OptList<RiemannSolver, RiemannSolver::hll, RiemannSolver::hllc>;
+using RiemannOptions =
+    OptList<RiemannSolver, RiemannSolver::hll, RiemannSolver::hllc, RiemannSolver::hlld>;
 using ReconstructVarsOptions = OptList<ReconstructVars, ReconstructVars::primitive>;
+using BatchModeOptions = OptList<BatchMode, BatchMode::scalar, BatchMode::simd>;
+using FluxPrecisionOptions =
+    OptList<FluxPrecision, FluxPrecision::full, FluxPrecision::mixed>;
 using EMFOptions = OptList<EMFAveraging, EMFAveraging::arithmetic>;
 
+// --8<-- [start:scratch]
 struct RiemannScratch {
   static constexpr auto TT = TopologicalType::Cell;
   using Minus = RuntimeScratchVariable<"minus", TT>;
@@ -41,6 +49,7 @@ struct RiemannScratch {
 
   using type = RuntimeScratchVariableList<Minus, Plus>;
 };
+// --8<-- [end:scratch]
 
 struct HydroBase {
   // variables that have fluxes and are independent on all mesh containers
@@ -89,15 +98,17 @@ struct ReconVars<TypeList<Cs...>, TypeList<Vs...>, ReconstructVars::primitive> {
 };
 
 // --8<-- [start:traits]
-template <Fluid fluid, Mhd mhd, ReconstructVars recon_vars>
+template <Fluid fluid, Mhd mhd, ReconstructVars recon_vars,
+          Species species = Species::single>
 struct HydroTraits {
   using fluid_vars = hydro_vars<fluid>;
   using mhd_vars = hydro_vars<mhd>;
 
   // Mass Scalars are advected like d_t phi + div . (rho * u * phi) = 0
-  // these may not always be allocated / registered as fields so we
-  // need to check pack.GetUpperBound(b, T) >= 0
-  using MassScalars = TypeList<material::MFRAC>;
+  // these are only registered with multiple species, and may not always be
+  // allocated so we need to check pack.GetUpperBound(b, T) >= 0
+  using MassScalars = std::conditional_t<species == Species::multi,
+                                         TypeList<material::MFRAC>, TypeList<>>;
 
   using WithFlux =
       ConcatTypeLists_t<typename fluid_vars::WithFlux, typename mhd_vars::WithFlux>;
@@ -113,6 +124,7 @@ struct HydroTraits {
   using All = ConcatTypeLists_t<ConsPrim, NonFlux>;
   static constexpr auto FLUID = fluid;
   static constexpr auto MHD = mhd;
+  static constexpr auto SPECIES = species;
   static constexpr std::size_t ncons = Conserved::n_types;
 };
 // --8<-- [end:traits]
@@ -133,10 +145,12 @@ concept HydroTrait =
       typename T::All;
       typename T::fluid_vars;
       typename T::mhd_vars;
+      typename T::MassScalars;
 
       // Static constexpr members with specific types
       { T::FLUID } -> std::same_as<const Fluid &>;
       { T::MHD } -> std::same_as<const Mhd &>;
+      { T::SPECIES } -> std::same_as<const Species &>;
       { T::ncons } -> std::same_as<const std::size_t &>;
     } && TemplateSpecialization<typename T::WithFlux, TypeList> &&
     TemplateSpecialization<typename T::NonFlux, TypeList> &&
@@ -147,30 +161,45 @@ concept HydroTrait =
     TemplateSpecialization<typename T::All, TypeList>;
 
 struct HydroFactory : OptionFactory {
-  using options = OptTypeList<FluidOptions, MhdOptions, ReconstructVarsOptions>;
+  using options =
+      OptTypeList<FluidOptions, MhdOptions, ReconstructVarsOptions, SpeciesOptions>;
 
-  template <Fluid fluid, Mhd mhd, ReconstructVars recon_vars>
-  using composite = HydroTraits<fluid, mhd, recon_vars>;
+  template <Fluid fluid, Mhd mhd, ReconstructVars recon_vars, Species species>
+  using composite = HydroTraits<fluid, mhd, recon_vars, species>;
   using type = HydroFactory;
 };
 
-template <Reconstruction recon, SlopeLimiter limiter>
+template <Reconstruction recon, SlopeLimiter limiter,
+          BatchMode batch_mode = BatchMode::scalar,
+          FluxPrecision flux_precision = FluxPrecision::full>
 struct ReconstructTraits {
   static constexpr auto reconstruction = recon;
   static constexpr auto slope_limiter = limiter;
+  // reconstruct & riemann solve pencils in simd batches of cells along i
+  static constexpr auto batch = batch_mode;
+  // reconstructed riemann states are held in single precision with mixed,
+  // fluxes are always accumulated in Real
+  static constexpr auto precision = flux_precision;
+  using state_t =
+      std::conditional_t<flux_precision == FluxPrecision::mixed, float, Real>;
 };
 
 template <typename T>
 concept ReconstructTrait = requires {
   { T::reconstruction } -> std::same_as<const Reconstruction &>;
   { T::slope_limiter } -> std::same_as<const SlopeLimiter &>;
+  { T::batch } -> std::same_as<const BatchMode &>;
+  { T::precision } -> std::same_as<const FluxPrecision &>;
+  typename T::state_t;
 };
 
 struct ReconstructionFactory : OptionFactory {
-  using options = OptTypeList<ReconstructionOptions, SlopeLimiterOptions>;
+  using options = OptTypeList<ReconstructionOptions, SlopeLimiterOptions,
+                              BatchModeOptions, FluxPrecisionOptions>;
 
-  template <Reconstruction recon, SlopeLimiter limiter>
-  using composite = ReconstructTraits<recon, limiter>;
+  template <Reconstruction recon, SlopeLimiter limiter, BatchMode batch_mode,
+            FluxPrecision flux_precision>
+  using composite = ReconstructTraits<recon, limiter, batch_mode, flux_precision>;
   using type = ReconstructionFactory;
 };
 
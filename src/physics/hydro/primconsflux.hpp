@@ -1,5 +1,9 @@
 #ifndef PHYSICS_HYDRO_PRIMCONSFLUX_HPP_
 #define PHYSICS_HYDRO_PRIMCONSFLUX_HPP_
+#include <limits>
+#include <type_traits>
+#include <utility>
+
 #include <Kokkos_Core.hpp>
 
 #include "driver/kamayan_driver_types.hpp"
@@ -7,6 +11,7 @@
 #include "grid/grid_types.hpp"
 #include "grid/subpack.hpp"
 #include "kamayan/fields.hpp"
+#include "kamayan_utils/robust.hpp"
 #include "physics/hydro/hydro_types.hpp"
 #include "physics/physics_types.hpp"
 
@@ -18,9 +23,20 @@ TaskStatus PrepareConserved(MeshData *md);
 // these will prepare any U <-> V in our data at the end of the hydro cycle
 TaskStatus PreparePrimitive(MeshData *md);
 
+// value type held by a state indexer, either Real or a simd batch of Reals
+template <typename State>
+using StateValue_t = std::remove_cvref_t<decltype(std::declval<const State &>()(DENS()))>;
+
+// smallest normal value of a state value type, so it doesn't flush to zero for
+// single precision states
+template <typename value_t>
+inline constexpr Real state_tiny_v = std::numeric_limits<Real>::min();
+template <>
+inline constexpr Real state_tiny_v<float> = std::numeric_limits<float>::min();
+
 template <Mhd mhd, typename Prim>
-KOKKOS_INLINE_FUNCTION Real TotalPres(const Prim &V) {
-  Real pres = V(PRES());
+KOKKOS_INLINE_FUNCTION auto TotalPres(const Prim &V) {
+  StateValue_t<Prim> pres = V(PRES());
   if constexpr (mhd != Mhd::off) {
     pres += 0.5 *
             (V(MAGC(0)) * V(MAGC(0)) + V(MAGC(1)) * V(MAGC(1)) + V(MAGC(2)) * V(MAGC(2)));
@@ -29,18 +45,19 @@ KOKKOS_INLINE_FUNCTION Real TotalPres(const Prim &V) {
   return pres;
 }
 template <Mhd mhd, typename Prim>
-KOKKOS_INLINE_FUNCTION Real FastSpeed(const int &dir1, const Prim &V) {
-  const Real idens = 1. / V(DENS());
-  const Real a2 = idens * V(BMOD());
+KOKKOS_INLINE_FUNCTION auto FastSpeed(const int &dir1, const Prim &V) {
+  using value_t = StateValue_t<Prim>;
+  const value_t idens = 1. / V(DENS());
+  const value_t a2 = idens * V(BMOD());
 
-  Real cfast2;
+  value_t cfast2;
   if constexpr (mhd == Mhd::off) {
     // sound speed
     cfast2 = a2;
   } else {
     // fast magneto-sonic speed
-    const Real bb2 = V(MAGC(dir1)) * V(MAGC(dir1)) * idens;
-    Real b2 = 0.0;
+    const value_t bb2 = V(MAGC(dir1)) * V(MAGC(dir1)) * idens;
+    value_t b2 = 0.0;
     for (int dir = 0; dir < 3; dir++) {
       b2 += V(MAGC(dir)) * V(MAGC(dir));
     }
@@ -52,12 +69,47 @@ KOKKOS_INLINE_FUNCTION Real FastSpeed(const int &dir1, const Prim &V) {
   return Kokkos::sqrt(cfast2);
 }
 
+// wraps a state with its fast speed along the face normal already known, such as
+// the cell centered speeds cached in CFAST by the eos
+template <typename State, typename value_t>
+struct FastSpeedState {
+  KOKKOS_INLINE_FUNCTION FastSpeedState(const State &state_, const value_t &cfast_)
+      : state(state_), cfast(cfast_) {}
+
+  template <typename V>
+  KOKKOS_INLINE_FUNCTION decltype(auto) operator()(const V &var) const {
+    return state(var);
+  }
+
+  State state;
+  value_t cfast;
+};
+
+template <typename T>
+concept CachedFastSpeed = requires(const T &V) { V.cfast; };
+
+template <Mhd mhd, typename Prim>
+requires(CachedFastSpeed<Prim>)
+KOKKOS_INLINE_FUNCTION auto FastSpeed(const int &dir1, const Prim &V) {
+  return StateValue_t<Prim>(V.cfast);
+}
+
+// fill the cached fast speeds, one component for each direction with mhd
+template <Mhd mhd, typename Prim>
+KOKKOS_INLINE_FUNCTION void CacheFastSpeed(Prim &V) {
+  constexpr int ndir = mhd == Mhd::off ? 1 : 3;
+  for (int dir = 0; dir < ndir; dir++) {
+    V(CFAST(dir)) = FastSpeed<mhd>(dir, V);
+  }
+}
+
 template <typename hydro_traits, typename Prim, typename Cons>
 KOKKOS_INLINE_FUNCTION void Prim2Cons(const Prim &V, Cons &U) {
+  using value_t = StateValue_t<Prim>;
   // --8<-- [start:use-idx]
   U(DENS()) = V(DENS());
-  Real emag = 0.;
-  Real ekin = 0.;
+  value_t emag = 0.;
+  value_t ekin = 0.;
   for (int dir = 0; dir < 3; dir++) {
     U(MOMENTUM(dir)) = V(DENS()) * V(VELOCITY(dir));
     ekin += V(VELOCITY(dir)) * V(VELOCITY(dir));
@@ -67,7 +119,7 @@ KOKKOS_INLINE_FUNCTION void Prim2Cons(const Prim &V, Cons &U) {
     }
   }
   // --8<-- [end:use-idx]
-  const Real eint = V(EINT()) * V(DENS());
+  const value_t eint = V(EINT()) * V(DENS());
   ekin *= 0.5 * V(DENS());
   emag *= 0.5;
   U(ENER()) = eint + ekin + emag;
@@ -97,9 +149,56 @@ KOKKOS_INLINE_FUNCTION void Cons2Prim(const Cons &U, Prim &V) {
   // V(PRES()) = (V(GAME()) - 1.0) * eint;
 }
 
+// recover the primitives of cell (b, k, j, i) in pack after a stage update, leaving
+// the pressure & rest of the eos variables for the eos
+template <typename hydro_traits, Geometry geom, typename Pack, typename Coords>
+requires(NonTypeTemplateSpecialization<hydro_traits, HydroTraits>)
+KOKKOS_INLINE_FUNCTION void PreparePrimitiveCell(const Pack &pack, const Coords &coords,
+                                                 const int ndim, const int b,
+                                                 const int k, const int j, const int i) {
+  if constexpr (hydro_traits::MHD == Mhd::ct) {
+    using TE = TopologicalElement;
+    if (ndim > 1) {
+      pack(b, MAGC(0), k, j, i) =
+          0.5 * coords.template Dx<Axis::IAXIS>(k, j, i) *
+          (coords.template FaceArea<Axis::IAXIS>(k, j, i + 1) *
+               pack(b, TE::F1, MAG(), k, j, i + 1) +
+           coords.template FaceArea<Axis::IAXIS>(k, j, i) *
+               pack(b, TE::F1, MAG(), k, j, i)) /
+          coords.CellVolume(k, j, i);
+      pack(b, MAGC(1), k, j, i) =
+          0.5 * coords.template Dx<Axis::JAXIS>(k, j, i) *
+          (coords.template FaceArea<Axis::JAXIS>(k, j + 1, i) *
+               pack(b, TE::F2, MAG(), k, j + 1, i) +
+           coords.template FaceArea<Axis::JAXIS>(k, j, i) *
+               pack(b, TE::F2, MAG(), k, j, i)) /
+          coords.CellVolume(k, j, i);
+    }
+    if (ndim > 2) {
+      pack(b, MAGC(2), k, j, i) =
+          0.5 * coords.template Dx<Axis::KAXIS>(k, j, i) *
+          (coords.template FaceArea<Axis::KAXIS>(k + 1, j, i) *
+               pack(b, TE::F3, MAG(), k + 1, j, i) +
+           coords.template FaceArea<Axis::KAXIS>(k, j, i) *
+               pack(b, TE::F3, MAG(), k, j, i)) /
+          coords.CellVolume(k, j, i);
+    }
+  }
+  auto U = SubPack(pack, b, k, j, i);
+  Cons2Prim<hydro_traits>(U, U);
+  if constexpr (geom == Geometry::cylindrical) {
+    // conserve angular momentum
+    U(VELOCITY(2)) *= utils::Ratio(1.0, coords.template Xc<Axis::IAXIS>(k, j, i));
+    if constexpr (hydro_traits::MHD != Mhd::off) {
+      U(MAGC(2)) *= coords.template Xc<Axis::IAXIS>(k, j, i);
+    }
+  }
+}
+
 template <std::size_t dir1, typename hydro_traits, typename Prim, typename Flux>
 requires(NonTypeTemplateSpecialization<hydro_traits, HydroTraits>)
 KOKKOS_INLINE_FUNCTION void Prim2Flux(const Prim &V, Flux &F) {
+  using value_t = StateValue_t<Prim>;
   constexpr std::size_t dir2 = (dir1 + 1) % 3;
   constexpr std::size_t dir3 = (dir1 + 2) % 3;
 
@@ -108,10 +207,10 @@ KOKKOS_INLINE_FUNCTION void Prim2Flux(const Prim &V, Flux &F) {
   F(MOMENTUM(dir2)) = F(DENS()) * V(VELOCITY(dir2));
   F(MOMENTUM(dir3)) = F(DENS()) * V(VELOCITY(dir3));
 
-  Real ptot = V(PRES());
-  Real B2 = 0.;
-  Real uB = 0.;
-  Real ekin = 0.;
+  value_t ptot = V(PRES());
+  value_t B2 = 0.;
+  value_t uB = 0.;
+  value_t ekin = 0.;
   for (int dir = 0; dir < 3; dir++) {
     F(MOMENTUM(dir)) = F(DENS()) * V(VELOCITY(dir));
     ekin += V(VELOCITY(dir)) * V(VELOCITY(dir));
@@ -122,9 +221,9 @@ KOKKOS_INLINE_FUNCTION void Prim2Flux(const Prim &V, Flux &F) {
     }
   }
   ekin *= 0.5 * V(DENS());
-  const Real emag = 0.5 * B2;
+  const value_t emag = 0.5 * B2;
   ptot += 0.5 * B2;
-  const Real etot = V(EINT()) * V(DENS()) + ekin + emag;
+  const value_t etot = V(EINT()) * V(DENS()) + ekin + emag;
 
   F(MOMENTUM(dir1)) += ptot;
   F(ENER()) = (etot + ptot) * V(VELOCITY(dir1));
@@ -0,0 +1,188 @@
+#ifndef PHYSICS_HYDRO_RECONSTRUCTION_SIMD_HPP_
+#define PHYSICS_HYDRO_RECONSTRUCTION_SIMD_HPP_
+#include <Kokkos_Core.hpp>
+
+#include "grid/grid_types.hpp"
+#include "grid/indexer.hpp"
+#include "kamayan_utils/parallel.hpp"
+#include "kamayan_utils/simd.hpp"
+#include "physics/hydro/hydro_types.hpp"
+#include "physics/hydro/reconstruction.hpp"
+
+namespace kamayan::hydro {
+// Batched versions of the kernels in reconstruction.hpp. Each call reconstructs
+// simd_width contiguous cells along i, and should reproduce the scalar kernels
+// lane by lane.
+
+// loads a batch of contiguous cells along i from a scalar stencil that is
+// centered on the first cell of the batch
+template <typename Stencil>
+requires(Stencil1D<Stencil>)
+struct SimdStencil1D {
+  KOKKOS_INLINE_FUNCTION explicit SimdStencil1D(Stencil stencil_) : stencil(stencil_) {}
+
+  KOKKOS_INLINE_FUNCTION SimdReal operator()(const int &idx) {
+    return SimdLoad(&stencil(idx));
+  }
+
+ private:
+  Stencil stencil;
+};
+
+template <SlopeLimiter limiter>
+KOKKOS_INLINE_FUNCTION SimdReal LimitedSlope(const SimdReal &a, const SimdReal &b) {
+  const SimdReal one(1.0);
+  if constexpr (limiter == SlopeLimiter::mc) {
+    return (Kokkos::copysign(one, a) + Kokkos::copysign(one, b)) *
+           Kokkos::min(Kokkos::abs(a), Kokkos::min(SimdReal(.25) * Kokkos::abs(a + b),
+                                                   Kokkos::abs(b)));
+  } else if constexpr (limiter == SlopeLimiter::van_leer) {
+    return Select(a * b > SimdReal(0.), SimdReal(2.) * a * b / (a + b), SimdReal(0.));
+  } else if constexpr (limiter == SlopeLimiter::minmod) {
+    return SimdReal(0.5) * (Kokkos::copysign(one, a) + Kokkos::copysign(one, b)) *
+           Kokkos::min(Kokkos::abs(a), Kokkos::abs(b));
+  }
+
+  return SimdReal(0.);
+}
+
+template <SlopeLimiter limiter, typename Container>
+KOKKOS_INLINE_FUNCTION SimdReal SlopeBatch(const int &idx, Container stencil) {
+  return LimitedSlope<limiter>(stencil(idx + 1) - stencil(idx),
+                               stencil(idx) - stencil(idx - 1));
+}
+
+template <ReconstructTrait reconstruct_traits, typename Container>
+requires(reconstruct_traits::reconstruction == Reconstruction::fog)
+KOKKOS_INLINE_FUNCTION void ReconstructBatch(Container stencil, SimdReal &vM,
+                                             SimdReal &vP) {
+  vM = stencil(0);
+  vP = stencil(0);
+}
+
+template <ReconstructTrait reconstruct_traits, typename Container>
+requires(reconstruct_traits::reconstruction == Reconstruction::plm)
+KOKKOS_INLINE_FUNCTION void ReconstructBatch(Container stencil, SimdReal &vM,
+                                             SimdReal &vP) {
+  const SimdReal v0 = stencil(0);
+  const SimdReal dvL = v0 - stencil(-1);
+  const SimdReal dvR = stencil(1) - v0;
+  const SimdReal del = LimitedSlope<reconstruct_traits::slope_limiter>(dvL, dvR);
+  vM = v0 - SimdReal(0.5) * del;
+  vP = v0 + SimdReal(0.5) * del;
+}
+
+template <ReconstructTrait reconstruct_traits, typename Container>
+requires(reconstruct_traits::reconstruction == Reconstruction::ppm)
+KOKKOS_INLINE_FUNCTION void ReconstructBatch(Container stencil, SimdReal &vM,
+                                             SimdReal &vP) {
+  constexpr SlopeLimiter limiter = reconstruct_traits::slope_limiter;
+  const SimdReal sixth(1. / 6.);
+  const SimdReal v0 = stencil(0);
+  const SimdReal dv_p = SlopeBatch<limiter>(1, stencil);
+  const SimdReal dv_0 = SlopeBatch<limiter>(0, stencil);
+  const SimdReal dv_m = SlopeBatch<limiter>(-1, stencil);
+
+  vM = SimdReal(0.5) * (stencil(-1) + v0) - sixth * (dv_0 - dv_m);
+  vP = SimdReal(0.5) * (v0 + stencil(1)) - sixth * (dv_p - dv_0);
+
+  // branches of the scalar kernel become lane-wise selects, applied in the same order
+  const auto extrema = (vP - v0) * (v0 - vM) <= SimdReal(0.);
+  vM = Select(extrema, v0, vM);
+  vP = Select(extrema, v0, vP);
+
+  const SimdReal six(6.);
+  auto dv = vP - vM;
+  vP = Select(-dv * dv > six * dv * (v0 - SimdReal(0.5) * (vP + vM)),
+              SimdReal(3.0) * v0 - SimdReal(2.) * vM, vP);
+  dv = vP - vM;
+  vM = Select(dv * dv < six * dv * (v0 - SimdReal(0.5) * (vP + vM)),
+              SimdReal(3.0) * v0 - SimdReal(2.) * vP, vM);
+}
+
+template <ReconstructTrait reconstruct_traits, typename Container>
+requires(reconstruct_traits::reconstruction == Reconstruction::wenoz)
+KOKKOS_INLINE_FUNCTION void ReconstructBatch(Container stencil, SimdReal &vM,
+                                             SimdReal &vP) {
+  // load the 5 point stencil once
+  const Kokkos::Array<SimdReal, 5> v{stencil(-2), stencil(-1), stencil(0), stencil(1),
+                                     stencil(2)};
+  const auto s = [&](const int &idx) { return v[idx + 2]; };
+  const SimdReal sixth(1. / 6.);
+
+  const auto eno_reconstruction = [&](const int &pm) {
+    Kokkos::Array<SimdReal, 3> eno;
+    eno[0] = sixth * (-s(pm * 2) + SimdReal(5.) * s(pm * 1) + SimdReal(2.) * s(0));
+    eno[1] = sixth * (SimdReal(2.) * s(pm * 1) + SimdReal(5.) * s(0) - s(-pm * 1));
+    eno[2] = sixth * (SimdReal(11.) * s(0) - SimdReal(7.) * s(-pm * 1) +
+                      SimdReal(2.) * s(-pm * 2));
+    return eno;
+  };
+
+  const auto eno_plus = eno_reconstruction(1);
+  const auto eno_minus = eno_reconstruction(-1);
+
+  const auto sqr = [](const SimdReal &x) { return x * x; };
+  const SimdReal c13_12(13. / 12.);
+  const SimdReal c1_4(0.25);
+  const Kokkos::Array<SimdReal, 3> smoothness_indicators = {
+      c13_12 * sqr(s(-2) - SimdReal(2.) * s(-1) + s(0)) +
+          c1_4 * sqr(s(-2) - SimdReal(4.) * s(-1) + SimdReal(3.) * s(0)),
+      c13_12 * sqr(s(-1) - SimdReal(2.) * s(0) + s(1)) + c1_4 * sqr(s(-1) - s(1)),
+      c13_12 * sqr(s(0) - SimdReal(2.) * s(1) + s(2)) +
+          c1_4 * sqr(s(2) - SimdReal(4.) * s(1) + SimdReal(3.) * s(0))};
+
+  // m = 2 in the scalar kernel, so the power is just a square
+  const SimdReal eps(1.e-36);
+  const SimdReal one(1.0);
+  const SimdReal tau = Kokkos::abs(smoothness_indicators[2] - smoothness_indicators[0]);
+  const auto weno_weighting = [&](const int &pm, const Kokkos::Array<SimdReal, 3> eno) {
+    const SimdReal w0 =
+        SimdReal(3.) * (one + sqr(tau / (eps + smoothness_indicators[1 + pm])));
+    const SimdReal w1 =
+        SimdReal(6.) * (one + sqr(tau / (eps + smoothness_indicators[1])));
+    const SimdReal w2 =
+        SimdReal(1.) * (one + sqr(tau / (eps + smoothness_indicators[1 - pm])));
+
+    const SimdReal norm = w0 + w1 + w2;
+    return (w0 * eno[0] + w1 * eno[1] + w2 * eno[2]) / norm;
+  };
+  vM = weno_weighting(-1, eno_minus);
+  vP = weno_weighting(1, eno_plus);
+}
+
+// reconstruct nvar variables over the cells [il, iu] of a pencil along i into vM & vP.
+// make_stencil(var, i) gives the Stencil1D centered on cell i. With the simd batch mode
+// the pencil is done in batches of simd_width cells with a scalar remainder. The
+// reconstruction is done in Real and stored at the precision of the scratch pads.
+template <ReconstructTrait reconstruction_traits, typename StencilFactory,
+          typename ScratchPad>
+KOKKOS_INLINE_FUNCTION void ReconstructPencil(parthenon::team_mbr_t member,
+                                              const int nvar, const int il,
+                                              const int iu, StencilFactory make_stencil,
+                                              ScratchPad &vM, ScratchPad &vP) {
+  int ir = il;
+  if constexpr (reconstruction_traits::batch == BatchMode::simd) {
+    const int nbatch = (iu - il + 1) / simd_width;
+    par_for_inner(member, 0, nvar - 1, 0, nbatch - 1, [&](const int var, const int n) {
+      const int i = il + n * simd_width;
+      SimdReal sM, sP;
+      ReconstructBatch<reconstruction_traits>(SimdStencil1D(make_stencil(var, i)), sM,
+                                              sP);
+      SimdStore(sM, &vM(var, i));
+      SimdStore(sP, &vP(var, i));
+    });
+    ir += nbatch * simd_width;
+  }
+
+  par_for_inner(member, 0, nvar - 1, ir, iu, [&](const int var, const int i) {
+    Real sM, sP;
+    Reconstruct<reconstruction_traits>(make_stencil(var, i), sM, sP);
+    vM(var, i) = sM;
+    vP(var, i) = sP;
+  });
+}
+
+}  // namespace kamayan::hydro
+
+#endif  // PHYSICS_HYDRO_RECONSTRUCTION_SIMD_HPP_
@@ -1,12 +1,20 @@
 #ifndef PHYSICS_HYDRO_RIEMANN_SOLVER_HPP_
 #define PHYSICS_HYDRO_RIEMANN_SOLVER_HPP_
 #include <limits>
+#include <type_traits>
 
 #include <Kokkos_Core.hpp>
 
+#include "grid/coordinates.hpp"
+#include "grid/geometry_types.hpp"
 #include "grid/grid_types.hpp"
+#include "grid/indexer.hpp"
+#include "grid/subpack.hpp"
 #include "hydro_types.hpp"
 #include "kamayan/fields.hpp"
+#include "kamayan_utils/parallel.hpp"
+#include "kamayan_utils/robust.hpp"
+#include "kamayan_utils/simd.hpp"
 #include "kamayan_utils/type_list_array.hpp"
 #include "primconsflux.hpp"
 
@@ -22,21 +30,23 @@ template <TopologicalElement face, RiemannSolver riemann, HydroTrait hydro_trait
 requires(riemann == RiemannSolver::hll)
 KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
                                         const ScratchR &vR) {
+  // Real, or a simd batch of faces
+  using value_t = StateValue_t<ScratchL>;
   constexpr std::size_t dir1 = static_cast<std::size_t>(face) % 3;
   constexpr std::size_t dir2 = (dir1 + 1) % 3;
   constexpr std::size_t dir3 = (dir1 + 2) % 3;
 
-  const Real cfL = FastSpeed<hydro_traits::MHD>(dir1, vL);
-  const Real cfR = FastSpeed<hydro_traits::MHD>(dir1, vR);
+  const value_t cfL = FastSpeed<hydro_traits::MHD>(dir1, vL);
+  const value_t cfR = FastSpeed<hydro_traits::MHD>(dir1, vR);
 
-  const Real tiny = std::numeric_limits<Real>::min();
-  const Real sL =
+  const value_t tiny = state_tiny_v<value_t>;
+  const value_t sL =
       Kokkos::min(-tiny, Kokkos::min(vL(VELOCITY(dir1)) - cfL, vR(VELOCITY(dir1)) - cfR));
-  const Real sR =
+  const value_t sR =
       Kokkos::max(tiny, Kokkos::max(vL(VELOCITY(dir1)) + cfL, vR(VELOCITY(dir1)) + cfR));
-  const Real sRmsLi = 1.0 / (sR - sL);
+  const value_t sRmsLi = 1.0 / (sR - sL);
 
-  using Array_t = TypeListArray<typename hydro_traits::Conserved>;
+  using Array_t = TypeListArray<typename hydro_traits::Conserved, value_t>;
   Array_t UL, UR, FL, FR;
   // --8<-- [start:tl-arr]
   Prim2Cons<hydro_traits>(vL, UL);
@@ -61,22 +71,24 @@ template <TopologicalElement face, RiemannSolver riemann, HydroTrait hydro_trait
 requires(riemann == RiemannSolver::hllc)
 KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
                                         const ScratchR &vR) {
+  // Real, or a simd batch of faces
+  using value_t = StateValue_t<ScratchL>;
   constexpr std::size_t dir1 = static_cast<std::size_t>(face) % 3;
   constexpr std::size_t dir2 = (dir1 + 1) % 3;
   constexpr std::size_t dir3 = (dir1 + 2) % 3;
 
-  const Real cfL = FastSpeed<hydro_traits::MHD>(dir1, vL);
-  const Real cfR = FastSpeed<hydro_traits::MHD>(dir1, vR);
+  const value_t cfL = FastSpeed<hydro_traits::MHD>(dir1, vL);
+  const value_t cfR = FastSpeed<hydro_traits::MHD>(dir1, vR);
 
-  const Real tiny = std::numeric_limits<Real>::min();
-  const Real sL =
+  const value_t tiny = state_tiny_v<value_t>;
+  const value_t sL =
       Kokkos::min(-tiny, Kokkos::min(vL(VELOCITY(dir1)) - cfL, vR(VELOCITY(dir1)) - cfR));
-  const Real sR =
+  const value_t sR =
       Kokkos::max(tiny, Kokkos::max(vL(VELOCITY(dir1)) + cfL, vR(VELOCITY(dir1)) + cfR));
-  const Real sRmsLi = 1.0 / (sR - sL);
+  const value_t sRmsLi = 1.0 / (sR - sL);
 
   using Conserved = hydro_traits::Conserved;
-  using Array_t = TypeListArray<Conserved>;
+  using Array_t = TypeListArray<Conserved, value_t>;
   Array_t UL, UR, FL, FR;
 
   Prim2Cons<hydro_traits>(vL, UL);
@@ -84,24 +96,24 @@ KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
   Prim2Flux<dir1, hydro_traits>(vR, FR);
   Prim2Flux<dir1, hydro_traits>(vL, FL);
 
-  const Real total_presL = TotalPres<hydro_traits::MHD>(vL);
-  const Real total_presR = TotalPres<hydro_traits::MHD>(vR);
+  const value_t total_presL = TotalPres<hydro_traits::MHD>(vL);
+  const value_t total_presR = TotalPres<hydro_traits::MHD>(vR);
 
-  Real ustar = total_presR - total_presL +
+  value_t ustar = total_presR - total_presL +
                UL(MOMENTUM(dir1)) * (sL - vL(VELOCITY(dir1))) -
                UR(MOMENTUM(dir1)) * (sR - vR(VELOCITY(dir1)));
   ustar =
       ustar * 1. /
       (vL(DENS()) * (sL - vL(VELOCITY(dir1))) - vR(DENS()) * (sR - vR(VELOCITY(dir1))));
 
-  Real pstar =
+  value_t pstar =
       0.5 * (total_presL + total_presR +
              vL(DENS()) * (sL - vL(VELOCITY(dir1))) * (ustar - vL(VELOCITY(dir1))) +
              vR(DENS()) * (sR - vR(VELOCITY(dir1))) * (ustar - vR(VELOCITY(dir1))));
 
-  const auto hllc_state = [&](const Real &S, const Array_t &U, const Real &Pu) {
+  const auto hllc_state = [&](const value_t &S, const Array_t &U, const value_t &Pu) {
     Array_t Ustar;
-    const Real susi = 1. / (S - ustar + tiny);
+    const value_t susi = 1. / (S - ustar + tiny);
     Ustar(DENS()) = susi * (S * U(DENS()) - U(MOMENTUM(dir1)));
     Ustar(MOMENTUM(dir1)) = Ustar(DENS()) * ustar;
     Ustar(MOMENTUM(dir2)) = U(MOMENTUM(dir2)) * Ustar(DENS()) / U(DENS());
@@ -109,7 +121,7 @@ KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
     Ustar(ENER()) = U(ENER()) * Ustar(DENS()) / U(DENS()) + susi * (pstar * ustar - Pu);
 
     if constexpr (hydro_traits::MHD != Mhd::off) {
-      const Real sRsLi = 1. / (sR - sL);
+      const value_t sRsLi = 1. / (sR - sL);
       const auto hll_state = [&]<typename Var>(const Var &var) {
         return sRsLi * (sR * UR(var) - sL * UL(var) + FL(var) - FR(var));
       };  // NOLINT
@@ -136,8 +148,9 @@ KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
 
   const auto UstarL = hllc_state(sL, UL, total_presL * vL(VELOCITY(dir1)));
   const auto UstarR = hllc_state(sR, UR, total_presR * vR(VELOCITY(dir1)));
-  const Real biasL = -Kokkos::min(-tiny, Kokkos::copysign(1., ustar));
-  const Real biasR = Kokkos::max(tiny, Kokkos::copysign(1., ustar));
+  const value_t one = 1.;
+  const value_t biasL = -Kokkos::min(-tiny, Kokkos::copysign(one, ustar));
+  const value_t biasR = Kokkos::max(tiny, Kokkos::copysign(one, ustar));
 
   type_for(Conserved(), [&]<typename Vars>(const Vars &) {
     for (int comp = 0; comp < pack.GetSize(Vars()); comp++) {
@@ -148,5 +161,279 @@ KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
   });
 }
 
+// without magnetic fields the rotational discontinuities vanish and hlld is hllc
+template <TopologicalElement face, RiemannSolver riemann, HydroTrait hydro_traits,
+          typename FluxIndexer, typename ScratchL, typename ScratchR>
+requires(riemann == RiemannSolver::hlld && hydro_traits::MHD == Mhd::off)
+KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
+                                        const ScratchR &vR) {
+  RiemannFlux<face, RiemannSolver::hllc, hydro_traits>(pack, vL, vR);
+}
+
+// Miyoshi & Kusano (2005), JCP 208, 315
+template <TopologicalElement face, RiemannSolver riemann, HydroTrait hydro_traits,
+          typename FluxIndexer, typename ScratchL, typename ScratchR>
+requires(riemann == RiemannSolver::hlld && hydro_traits::MHD != Mhd::off)
+KOKKOS_INLINE_FUNCTION void RiemannFlux(FluxIndexer &pack, const ScratchL &vL,
+                                        const ScratchR &vR) {
+  constexpr std::size_t dir1 = static_cast<std::size_t>(face) % 3;
+  constexpr std::size_t dir2 = (dir1 + 1) % 3;
+  constexpr std::size_t dir3 = (dir1 + 2) % 3;
+  constexpr Real small = 1.e-8;
+
+  const Real cfL = FastSpeed<hydro_traits::MHD>(dir1, vL);
+  const Real cfR = FastSpeed<hydro_traits::MHD>(dir1, vR);
+
+  const Real sL = Kokkos::min(vL(VELOCITY(dir1)) - cfL, vR(VELOCITY(dir1)) - cfR);
+  const Real sR = Kokkos::max(vL(VELOCITY(dir1)) + cfL, vR(VELOCITY(dir1)) + cfR);
+
+  using Conserved = hydro_traits::Conserved;
+  using Array_t = TypeListArray<Conserved>;
+  Array_t UL, UR, FL, FR;
+
+  Prim2Flux<dir1, hydro_traits>(vR, FR);
+  Prim2Flux<dir1, hydro_traits>(vL, FL);
+
+  // the whole fan is on one side of a supersonic face, so there is no star state
+  if (sL >= 0. || sR <= 0.) {
+    const auto &F = sL >= 0. ? FL : FR;
+    type_for(Conserved(), [&]<typename Vars>(const Vars &) {
+      for (int comp = 0; comp < pack.GetSize(Vars()); comp++) {
+        const auto var = Vars(comp);
+        pack.flux(face, var) = F(var);
+      }
+    });
+    return;
+  }
+
+  Prim2Cons<hydro_traits>(vL, UL);
+  Prim2Cons<hydro_traits>(vR, UR);
+
+  const Real total_presL = TotalPres<hydro_traits::MHD>(vL);
+  const Real total_presR = TotalPres<hydro_traits::MHD>(vR);
+  const Real Bx = 0.5 * (vL(MAGC(dir1)) + vR(MAGC(dir1)));
+  const Real Bx2 = Bx * Bx;
+
+  // contact speed & total pressure, constant across the whole riemann fan
+  const Real uL = vL(VELOCITY(dir1));
+  const Real uR = vR(VELOCITY(dir1));
+  const Real dsuL = vL(DENS()) * (sL - uL);
+  const Real dsuR = vR(DENS()) * (sR - uR);
+  const Real dsui = 1. / (dsuR - dsuL);
+  const Real sM = dsui * (dsuR * uR - dsuL * uL - total_presR + total_presL);
+  const Real pstar =
+      dsui * (dsuR * total_presL - dsuL * total_presR + dsuL * dsuR * (uR - uL));
+
+  // outer star states, bounded by the fast waves
+  const auto hlld_state = [&](const auto &V, const Array_t &U, const Real &S,
+                              const Real &total_pres) {
+    Array_t Ustar = U;
+    const Real u = V(VELOCITY(dir1));
+    const Real dsu = V(DENS()) * (S - u);
+    const Real ssMi = 1. / (S - sM);
+    Real v2 = V(VELOCITY(dir2));
+    Real v3 = V(VELOCITY(dir3));
+    Real b2 = V(MAGC(dir2));
+    Real b3 = V(MAGC(dir3));
+    const Real denom = dsu * (S - sM) - Bx2;
+    // degenerate when the fast wave coincides with the alfven wave
+    if (Kokkos::abs(denom) > small * pstar) {
+      const Real denomi = 1. / denom;
+      const Real vfac = Bx * (sM - u) * denomi;
+      const Real bfac = (dsu * (S - u) - Bx2) * denomi;
+      v2 -= vfac * b2;
+      v3 -= vfac * b3;
+      b2 *= bfac;
+      b3 *= bfac;
+    }
+    const Real vdotb =
+        u * Bx + V(VELOCITY(dir2)) * V(MAGC(dir2)) + V(VELOCITY(dir3)) * V(MAGC(dir3));
+    const Real vdotb_star = sM * Bx + v2 * b2 + v3 * b3;
+
+    Ustar(DENS()) = dsu * ssMi;
+    Ustar(MOMENTUM(dir1)) = Ustar(DENS()) * sM;
+    Ustar(MOMENTUM(dir2)) = Ustar(DENS()) * v2;
+    Ustar(MOMENTUM(dir3)) = Ustar(DENS()) * v3;
+    Ustar(MAGC(dir1)) = Bx;
+    Ustar(MAGC(dir2)) = b2;
+    Ustar(MAGC(dir3)) = b3;
+    Ustar(ENER()) = ssMi * ((S - u) * U(ENER()) - total_pres * u + pstar * sM +
+                            Bx * (vdotb - vdotb_star));
+    return Ustar;
+  };
+
+  const auto UstarL = hlld_state(vL, UL, sL, total_presL);
+  const auto UstarR = hlld_state(vR, UR, sR, total_presR);
+
+  // inner double star states, bounded by the alfven waves
+  const Real sqrt_dL = Kokkos::sqrt(UstarL(DENS()));
+  const Real sqrt_dR = Kokkos::sqrt(UstarR(DENS()));
+  const Real sLstar = sM - Kokkos::abs(Bx) / sqrt_dL;
+  const Real sRstar = sM + Kokkos::abs(Bx) / sqrt_dR;
+
+  auto UstarstarL = UstarL;
+  auto UstarstarR = UstarR;
+  if (0.5 * Bx2 > small * pstar) {
+    const Real sgn = Kokkos::copysign(1., Bx);
+    const Real sqrt_di = 1. / (sqrt_dL + sqrt_dR);
+    const auto vel = [](const Array_t &U, const std::size_t &dir) {
+      return U(MOMENTUM(dir)) / U(DENS());
+    };
+    const auto vel_ss = [&](const std::size_t &dir) {
+      return sqrt_di * (sqrt_dL * vel(UstarL, dir) + sqrt_dR * vel(UstarR, dir) +
+                        (UstarR(MAGC(dir)) - UstarL(MAGC(dir))) * sgn);
+    };
+    const auto mag_ss = [&](const std::size_t &dir) {
+      return sqrt_di * (sqrt_dL * UstarR(MAGC(dir)) + sqrt_dR * UstarL(MAGC(dir)) +
+                        sqrt_dL * sqrt_dR * (vel(UstarR, dir) - vel(UstarL, dir)) * sgn);
+    };
+    const Real v2 = vel_ss(dir2);
+    const Real v3 = vel_ss(dir3);
+    const Real b2 = mag_ss(dir2);
+    const Real b3 = mag_ss(dir3);
+    const Real vdotb_ss = sM * Bx + v2 * b2 + v3 * b3;
+
+    // side is -1 for the left state and +1 for the right
+    const auto hlld_double_state = [&](const Array_t &Ustar, Array_t &Ustarstar,
+                                       const Real &sqrt_d, const Real &side) {
+      const Real vdotb_star = sM * Bx + vel(Ustar, dir2) * Ustar(MAGC(dir2)) +
+                              vel(Ustar, dir3) * Ustar(MAGC(dir3));
+      Ustarstar(MOMENTUM(dir2)) = Ustar(DENS()) * v2;
+      Ustarstar(MOMENTUM(dir3)) = Ustar(DENS()) * v3;
+      Ustarstar(MAGC(dir2)) = b2;
+      Ustarstar(MAGC(dir3)) = b3;
+      Ustarstar(ENER()) = Ustar(ENER()) + side * sqrt_d * (vdotb_star - vdotb_ss) * sgn;
+    };
+    hlld_double_state(UstarL, UstarstarL, sqrt_dL, -1.);
+    hlld_double_state(UstarR, UstarstarR, sqrt_dR, 1.);
+  }
+
+  type_for(Conserved(), [&]<typename Vars>(const Vars &) {
+    for (int comp = 0; comp < pack.GetSize(Vars()); comp++) {
+      const auto var = Vars(comp);
+      if (sM >= 0.) {
+        const Real flux_star = FL(var) + sL * (UstarL(var) - UL(var));
+        pack.flux(face, var) = sLstar >= 0.
+                                   ? flux_star
+                                   : flux_star + sLstar * (UstarstarL(var) - UstarL(var));
+      } else {
+        const Real flux_star = FR(var) + sR * (UstarR(var) - UR(var));
+        pack.flux(face, var) = sRstar <= 0.
+                                   ? flux_star
+                                   : flux_star + sRstar * (UstarstarR(var) - UstarR(var));
+      }
+    }
+  });
+}
+
+// upwind the mass scalars of a face, or a simd batch of faces, with the density flux
+// the riemann solve just wrote, so they are done in the same pass over the faces
+template <TopologicalElement face, HydroTrait hydro_traits, typename FluxIndexer,
+          typename ScratchL, typename ScratchR>
+KOKKOS_INLINE_FUNCTION void UpwindMassScalars(FluxIndexer &pack, const ScratchL &vL,
+                                              const ScratchR &vR) {
+  // single precision states are upwinded in Real
+  using value_t = std::conditional_t<std::is_same_v<StateValue_t<ScratchL>, SimdReal>,
+                                     SimdReal, Real>;
+  const value_t one = 1.;
+  const value_t rho_flux = pack.flux(face, DENS());
+  const value_t wL = 0.5 * (one + Kokkos::copysign(one, rho_flux));
+  type_for(typename hydro_traits::MassScalars(), [&]<typename Vars>(const Vars &) {
+    for (int comp = 0; comp < pack.GetSize(Vars()); comp++) {
+      const auto var = Vars(comp);
+      const value_t phiL = vL(var);
+      const value_t phiR = vR(var);
+      pack.flux(face, var) = rho_flux * (wL * phiL + (one - wL) * phiR);
+    }
+  });
+}
+
+// Solve the riemann problem on the faces [il, iu] of the pencil at (b, k, j). The left
+// state of face i is in vL at i - 1 for F1 faces and at i otherwise, the right state
+// is in vR at i. With the simd batch mode cartesian faces are solved in batches of
+// simd_width faces with a scalar remainder. hlld branches on the wave pattern of each
+// face and is always solved face by face. Single precision states are solved in float
+// face by face, and widened to Real in the simd batches. With cached_speeds the wave
+// speeds come from CFAST in pack_flux of the cells on either side of the face. Any
+// mass scalars are upwinded along with each face, so their riemann states need to be
+// in vL & vR as well.
+template <TopologicalElement face, RiemannSolver riemann, HydroTrait hydro_traits,
+          Geometry geom, BatchMode batch, typename PackRecon, typename PackFlux,
+          typename ScratchPad>
+KOKKOS_INLINE_FUNCTION void
+RiemannPencil(parthenon::team_mbr_t member, PackRecon &pack_recon, PackFlux &pack_flux,
+              ScratchPad &vL, ScratchPad &vR, const int b, const int k, const int j,
+              const int il, const int iu, const bool cached_speeds = false) {
+  using TE = TopologicalElement;
+  constexpr int dir = static_cast<int>(face) % 3;
+  constexpr int di = face == TE::F1 ? 1 : 0;
+  // offsets to the cell on the left of the face
+  constexpr int dj = face == TE::F2 ? 1 : 0;
+  constexpr int dk = face == TE::F3 ? 1 : 0;
+  constexpr int cdir = hydro_traits::MHD == Mhd::off ? 0 : dir;
+  if constexpr (hydro_traits::MHD == Mhd::ct) {
+    // normal component of the field comes from the face field
+    par_for_inner(member, il, iu, [&](const int i) {
+      auto vLi = MakeScratchIndexer(pack_recon, vL, b, i - di);
+      auto vRi = MakeScratchIndexer(pack_recon, vR, b, i);
+      vLi(MAGC(dir)) = pack_flux(b, face, MAG(), k, j, i);
+      vRi(MAGC(dir)) = pack_flux(b, face, MAG(), k, j, i);
+    });
+    member.team_barrier();
+  }
+
+  int ir = il;
+  if constexpr (batch == BatchMode::simd && geom == Geometry::cartesian &&
+                riemann != RiemannSolver::hlld) {
+    const int nbatch = (iu - il + 1) / simd_width;
+    par_for_inner(member, 0, nbatch - 1, [&](const int n) {
+      const int i = il + n * simd_width;
+      auto vLi = MakeSimdScratchIndexer(pack_recon, vL, b, i - di);
+      auto vRi = MakeSimdScratchIndexer(pack_recon, vR, b, i);
+      auto flux_indexer = MakeSimdFluxIndexer(pack_flux, b, k, j, i);
+      if (cached_speeds) {
+        const auto cL = SimdLoad(&pack_flux(b, CFAST(cdir), k - dk, j - dj, i - di));
+        const auto cR = SimdLoad(&pack_flux(b, CFAST(cdir), k, j, i));
+        RiemannFlux<face, riemann, hydro_traits>(
+            flux_indexer, FastSpeedState(vLi, cL), FastSpeedState(vRi, cR));
+      } else {
+        RiemannFlux<face, riemann, hydro_traits>(flux_indexer, vLi, vRi);
+      }
+      if constexpr (hydro_traits::SPECIES == Species::multi) {
+        UpwindMassScalars<face, hydro_traits>(flux_indexer, vLi, vRi);
+      }
+    });
+    ir += nbatch * simd_width;
+  }
+
+  par_for_inner(member, ir, iu, [&](const int i) {
+    auto vLi = MakeScratchIndexer(pack_recon, vL, b, i - di);
+    auto vRi = MakeScratchIndexer(pack_recon, vR, b, i);
+    auto pack_indexer = SubPack(pack_flux, b, k, j, i);
+    if (cached_speeds) {
+      const Real cL = pack_flux(b, CFAST(cdir), k - dk, j - dj, i - di);
+      const Real cR = pack_flux(b, CFAST(cdir), k, j, i);
+      RiemannFlux<face, riemann, hydro_traits>(pack_indexer, FastSpeedState(vLi, cL),
+                                               FastSpeedState(vRi, cR));
+    } else {
+      RiemannFlux<face, riemann, hydro_traits>(pack_indexer, vLi, vRi);
+    }
+    if constexpr (hydro_traits::SPECIES == Species::multi) {
+      UpwindMassScalars<face, hydro_traits>(pack_indexer, vLi, vRi);
+    }
+    if constexpr (geom == Geometry::cylindrical && face != TE::F3) {
+      constexpr auto axis = face == TE::F1 ? Axis::IAXIS : Axis::JAXIS;
+      auto cpack = grid::CoordinatePack<Geometry::cylindrical, grid::Xface>(pack_flux, b);
+      if constexpr (face == TE::F1) {
+        pack_flux.flux(b, face, MOMENTUM(2), k, j, i) *= cpack.Xf<axis>(k, j, i);
+      }
+      if constexpr (hydro_traits::MHD == Mhd::ct) {
+        pack_flux.flux(b, face, MAGC(2), k, j, i) *=
+            utils::Ratio(1.0, cpack.Xf<axis>(k, j, i));
+      }
+    }
+  });
+}
+
 }  // namespace kamayan::hydro
 #endif  // PHYSICS_HYDRO_RIEMANN_SOLVER_HPP_
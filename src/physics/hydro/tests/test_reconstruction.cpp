@@ -7,6 +7,7 @@
 #include "kamayan_utils/type_abstractions.hpp"
 #include "physics/hydro/hydro_types.hpp"
 #include "physics/hydro/reconstruction.hpp"
+#include "physics/hydro/reconstruction_simd.hpp"
 
 namespace kamayan::hydro {
 
@@ -116,6 +117,14 @@ struct DataOneDReversed {
   std::vector<Real> data;
 };
 
+// stencil into contiguous data centered at i
+struct ArrayStencil {
+  Real &operator()(const int &idx) { return data[i + idx]; }
+
+  Real *data;
+  int i;
+};
+
 template <typename T>
 requires(NonTypeTemplateSpecialization<T, ReconstructTraits>)
 class ReconstructionTest : public testing::Test {};
@@ -193,4 +202,26 @@ TYPED_TEST(ReconstructionTest, LeftRightSymmetry) {
   EXPECT_DOUBLE_EQ(vP1, vM2);
 }
 
+TYPED_TEST(ReconstructionTest, SimdBatch) {
+  // each lane of the batched reconstruction should match the scalar kernel
+  // on the same stencil. Use a steep profile so limiters differ across lanes
+  constexpr int size = GetSize(TypeParam::reconstruction);
+  constexpr Real steepness = 4.0;
+  std::vector<Real> data(simd_width + 2 * size);
+  const int i0 = size;
+  const int nhalf = static_cast<int>(data.size()) / 2;
+  for (int n = 0; n < data.size(); n++) {
+    data[n] = TanhAvg(n - nhalf, steepness);
+  }
+
+  SimdReal sM, sP;
+  ReconstructBatch<TypeParam>(SimdStencil1D(ArrayStencil{data.data(), i0}), sM, sP);
+  for (int lane = 0; lane < simd_width; lane++) {
+    Real vM, vP;
+    Reconstruct<TypeParam>(ArrayStencil{data.data(), i0 + lane}, vM, vP);
+    EXPECT_DOUBLE_EQ(static_cast<Real>(sM[lane]), vM);
+    EXPECT_DOUBLE_EQ(static_cast<Real>(sP[lane]), vP);
+  }
+}
+
 }  // namespace kamayan::hydro
@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+#include "kamayan/fields.hpp"
+#include "kamayan_utils/simd.hpp"
+#include "kamayan_utils/type_list_array.hpp"
+#include "physics/hydro/hydro_types.hpp"
+#include "physics/hydro/riemann_solver.hpp"
+
+namespace kamayan::hydro {
+
+// fluxes for a single face, or a simd batch of faces
+template <typename hydro_traits, typename T>
+struct FaceFlux {
+  template <typename V>
+  T &flux(TopologicalElement, const V &var) {
+    return data(var);
+  }
+
+  // face field fluxes are handled by the emf calculation
+  template <typename V>
+  std::size_t GetSize(const V &) const {
+    return std::is_same_v<V, MAG> ? 0 : V::n_comps;
+  }
+
+  TypeListArray<typename hydro_traits::Conserved, T> data{T(0.)};
+};
+
+template <typename hydro_traits>
+using Prim_t = TypeListArray<typename hydro_traits::Primitive>;
+
+template <typename hydro_traits>
+Prim_t<hydro_traits> MakeState(const int lane, const Real sign) {
+  constexpr Real gamma = 1.4;
+  Prim_t<hydro_traits> V;
+  V(DENS()) = 1.0 + 0.1 * lane;
+  V(VELOCITY(0)) = sign * (0.3 - 0.2 * lane);
+  V(VELOCITY(1)) = 0.1 * lane;
+  V(VELOCITY(2)) = -0.05 * lane;
+  V(PRES()) = 1.0 + sign * 0.25 * lane;
+  V(BMOD()) = gamma * V(PRES());
+  V(EINT()) = V(PRES()) / ((gamma - 1.0) * V(DENS()));
+  if constexpr (hydro_traits::MHD != Mhd::off) {
+    V(MAGC(0)) = 0.75;
+    V(MAGC(1)) = sign * (0.5 + 0.1 * lane);
+    V(MAGC(2)) = 0.2 * lane;
+  }
+  return V;
+}
+
+// pack the lanes of scalar states into a state of simd batches
+template <typename hydro_traits>
+auto Batch(const std::array<Prim_t<hydro_traits>, simd_width> &states) {
+  TypeListArray<typename hydro_traits::Primitive, SimdReal> V;
+  for (int idx = 0; idx < Prim_t<hydro_traits>::n_vars; idx++) {
+    std::array<Real, simd_width> lanes;
+    for (int lane = 0; lane < simd_width; lane++) {
+      lanes[lane] = states[lane].data[idx];
+    }
+    V[idx] = SimdLoad(lanes.data());
+  }
+  return V;
+}
+
+template <RiemannSolver riemann, typename hydro_traits>
+void TestBatchRiemann() {
+  using TE = TopologicalElement;
+  std::array<Prim_t<hydro_traits>, simd_width> VL, VR;
+  for (int lane = 0; lane < simd_width; lane++) {
+    VL[lane] = MakeState<hydro_traits>(lane, 1.0);
+    VR[lane] = MakeState<hydro_traits>(lane, -1.0);
+  }
+
+  FaceFlux<hydro_traits, SimdReal> batch_flux;
+  RiemannFlux<TE::F1, riemann, hydro_traits>(batch_flux, Batch<hydro_traits>(VL),
+                                             Batch<hydro_traits>(VR));
+
+  for (int lane = 0; lane < simd_width; lane++) {
+    FaceFlux<hydro_traits, Real> flux;
+    RiemannFlux<TE::F1, riemann, hydro_traits>(flux, VL[lane], VR[lane]);
+    for (int idx = 0; idx < decltype(flux.data)::n_vars; idx++) {
+      std::array<Real, simd_width> lanes;
+      SimdStore(batch_flux.data[idx], lanes.data());
+      EXPECT_DOUBLE_EQ(lanes[lane], flux.data[idx]);
+    }
+  }
+}
+
+using hydro = HydroTraits<Fluid::oneT, Mhd::off, ReconstructVars::primitive>;
+using mhd = HydroTraits<Fluid::oneT, Mhd::ct, ReconstructVars::primitive>;
+
+TEST(Riemann, SimdBatchHll) {
+  TestBatchRiemann<RiemannSolver::hll, hydro>();
+  TestBatchRiemann<RiemannSolver::hll, mhd>();
+}
+
+TEST(Riemann, SimdBatchHllc) {
+  TestBatchRiemann<RiemannSolver::hllc, hydro>();
+  TestBatchRiemann<RiemannSolver::hllc, mhd>();
+}
+
+// with no jump across the face every intermediate state is the initial
+// state, so the upwinded flux must be the physical flux
+template <RiemannSolver riemann, typename hydro_traits>
+void TestConsistentFlux() {
+  using TE = TopologicalElement;
+  for (int lane = 0; lane < 4; lane++) {
+    const auto V = MakeState<hydro_traits>(lane, 1.0);
+    FaceFlux<hydro_traits, Real> flux;
+    RiemannFlux<TE::F1, riemann, hydro_traits>(flux, V, V);
+
+    TypeListArray<typename hydro_traits::Conserved> F;
+    Prim2Flux<0, hydro_traits>(V, F);
+    type_for(typename hydro_traits::Conserved(), [&]<typename Vars>(const Vars &) {
+      for (int comp = 0; comp < flux.GetSize(Vars()); comp++) {
+        const auto var = Vars(comp);
+        EXPECT_NEAR(flux.data(var), F(var), 1.e-12 * (1. + std::abs(F(var))));
+      }
+    });
+  }
+}
+
+// riemann states held in single precision should agree with the double
+// precision solve to about float epsilon
+template <RiemannSolver riemann, typename hydro_traits>
+void TestMixedPrecision() {
+  using TE = TopologicalElement;
+  for (int lane = 0; lane < 4; lane++) {
+    const auto VL = MakeState<hydro_traits>(lane, 1.0);
+    const auto VR = MakeState<hydro_traits>(lane, -1.0);
+    TypeListArray<typename hydro_traits::Primitive, float> VLf, VRf;
+    for (int idx = 0; idx < Prim_t<hydro_traits>::n_vars; idx++) {
+      VLf[idx] = static_cast<float>(VL.data[idx]);
+      VRf[idx] = static_cast<float>(VR.data[idx]);
+    }
+
+    FaceFlux<hydro_traits, Real> flux, flux_mixed;
+    RiemannFlux<TE::F1, riemann, hydro_traits>(flux, VL, VR);
+    RiemannFlux<TE::F1, riemann, hydro_traits>(flux_mixed, VLf, VRf);
+    for (int idx = 0; idx < decltype(flux.data)::n_vars; idx++) {
+      EXPECT_NEAR(flux_mixed.data[idx], flux.data[idx],
+                  1.e-5 * (1. + std::abs(flux.data[idx])));
+    }
+  }
+}
+
+TEST(Riemann, MixedPrecision) {
+  TestMixedPrecision<RiemannSolver::hll, hydro>();
+  TestMixedPrecision<RiemannSolver::hllc, hydro>();
+  TestMixedPrecision<RiemannSolver::hll, mhd>();
+  TestMixedPrecision<RiemannSolver::hllc, mhd>();
+  TestMixedPrecision<RiemannSolver::hlld, mhd>();
+}
+
+// a state wrapped with its own fast speed, as cached by the eos, should give the
+// same fluxes as computing the speed in the solver
+template <RiemannSolver riemann, typename hydro_traits>
+void TestCachedFastSpeed() {
+  using TE = TopologicalElement;
+  for (int lane = 0; lane < 4; lane++) {
+    const auto VL = MakeState<hydro_traits>(lane, 1.0);
+    const auto VR = MakeState<hydro_traits>(lane, -1.0);
+    const Real cL = FastSpeed<hydro_traits::MHD>(0, VL);
+    const Real cR = FastSpeed<hydro_traits::MHD>(0, VR);
+
+    FaceFlux<hydro_traits, Real> flux, flux_cached;
+    RiemannFlux<TE::F1, riemann, hydro_traits>(flux, VL, VR);
+    RiemannFlux<TE::F1, riemann, hydro_traits>(flux_cached, FastSpeedState(VL, cL),
+                                               FastSpeedState(VR, cR));
+    for (int idx = 0; idx < decltype(flux.data)::n_vars; idx++) {
+      EXPECT_DOUBLE_EQ(flux_cached.data[idx], flux.data[idx]);
+    }
+  }
+}
+
+TEST(Riemann, CachedFastSpeed) {
+  TestCachedFastSpeed<RiemannSolver::hll, hydro>();
+  TestCachedFastSpeed<RiemannSolver::hllc, hydro>();
+  TestCachedFastSpeed<RiemannSolver::hll, mhd>();
+  TestCachedFastSpeed<RiemannSolver::hllc, mhd>();
+  TestCachedFastSpeed<RiemannSolver::hlld, mhd>();
+}
+
+TEST(Riemann, HlldConsistent) {
+  TestConsistentFlux<RiemannSolver::hlld, hydro>();
+  TestConsistentFlux<RiemannSolver::hlld, mhd>();
+}
+
+template <typename hydro_traits>
+Prim_t<hydro_traits> MhdState(const Real dens, const Real pres,
+                              const std::array<Real, 3> &vel,
+                              const std::array<Real, 3> &mag) {
+  constexpr Real gamma = 1.4;
+  Prim_t<hydro_traits> V;
+  V(DENS()) = dens;
+  V(PRES()) = pres;
+  V(BMOD()) = gamma * pres;
+  V(EINT()) = pres / ((gamma - 1.0) * dens);
+  for (int dir = 0; dir < 3; dir++) {
+    V(VELOCITY(dir)) = vel[dir];
+    V(MAGC(dir)) = mag[dir];
+  }
+  return V;
+}
+
+// hlld resolves an isolated discontinuity exactly, so the flux through the face is
+// the physical flux of the state on the face
+template <typename hydro_traits>
+void TestExactFlux(const Prim_t<hydro_traits> &VL, const Prim_t<hydro_traits> &VR,
+                   const Prim_t<hydro_traits> &Vface) {
+  using TE = TopologicalElement;
+  FaceFlux<hydro_traits, Real> flux;
+  RiemannFlux<TE::F1, RiemannSolver::hlld, hydro_traits>(flux, VL, VR);
+
+  TypeListArray<typename hydro_traits::Conserved> F;
+  Prim2Flux<0, hydro_traits>(Vface, F);
+  type_for(typename hydro_traits::Conserved(), [&]<typename Vars>(const Vars &) {
+    for (int comp = 0; comp < flux.GetSize(Vars()); comp++) {
+      const auto var = Vars(comp);
+      EXPECT_NEAR(flux.data(var), F(var), 1.e-12 * (1. + std::abs(F(var))));
+    }
+  });
+}
+
+TEST(Riemann, HlldContact) {
+  // only the density jumps, and the contact moves with the flow
+  const std::array<Real, 3> mag{0.75, 0.5, -0.3};
+  for (const Real u : {0.0, 0.2, -0.2}) {
+    const std::array<Real, 3> vel{u, 0.1, -0.4};
+    const auto VL = MhdState<mhd>(1.0, 1.0, vel, mag);
+    const auto VR = MhdState<mhd>(0.2, 1.0, vel, mag);
+    TestExactFlux<mhd>(VL, VR, u < 0.0 ? VR : VL);
+  }
+}
+
+TEST(Riemann, HlldRotational) {
+  // at rest the left going alfven wave rotates the tangential field by 90 degrees, with
+  // [v_t] = sgn(Bx) [B_t] / sqrt(dens), leaving the right state on the face
+  const Real dens = 1.0;
+  for (const Real bx : {0.75, -0.75}) {
+    const Real sgn = std::copysign(1.0, bx);
+    const std::array<Real, 3> magL{bx, 0.5, 0.0};
+    const std::array<Real, 3> magR{bx, 0.0, 0.5};
+    const std::array<Real, 3> velL{0.0, 0.0, 0.0};
+    const std::array<Real, 3> velR{0.0, sgn * (magR[1] - magL[1]) / std::sqrt(dens),
+                                   sgn * (magR[2] - magL[2]) / std::sqrt(dens)};
+    const auto VL = MhdState<mhd>(dens, 1.0, velL, magL);
+    const auto VR = MhdState<mhd>(dens, 1.0, velR, magR);
+    TestExactFlux<mhd>(VL, VR, VR);
+  }
+}
+
+TEST(Riemann, HlldSupersonic) {
+  // every wave leaves the face on the same side
+  const std::array<Real, 3> mag{0.75, 0.5, -0.3};
+  const auto VL = MhdState<mhd>(1.0, 1.0, {5.0, 0.1, 0.0}, mag);
+  const auto VR = MhdState<mhd>(0.5, 0.8, {4.0, -0.1, 0.2}, mag);
+  TestExactFlux<mhd>(VL, VR, VL);
+
+  const auto VLm = MhdState<mhd>(1.0, 1.0, {-4.0, 0.1, 0.0}, mag);
+  const auto VRm = MhdState<mhd>(0.5, 0.8, {-5.0, -0.1, 0.2}, mag);
+  TestExactFlux<mhd>(VLm, VRm, VRm);
+}
+
+}  // namespace kamayan::hydro
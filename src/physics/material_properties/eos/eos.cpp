@@ -1,20 +1,29 @@
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
 #include "dispatcher/dispatcher.hpp"
 #include "dispatcher/options.hpp"
 #include "driver/kamayan_driver_types.hpp"
+#include "grid/coordinates.hpp"
+#include "grid/geometry_types.hpp"
 #include "grid/grid.hpp"
 #include "grid/grid_types.hpp"
 #include "grid/subpack.hpp"
 #include "kamayan/runtime_parameters.hpp"
 #include "kamayan/unit.hpp"
 #include "kamayan/unit_data.hpp"
+#include "kamayan_utils/strings.hpp"
+#include "kamayan_utils/type_list.hpp"
 #include "kokkos_abstraction.hpp"
+#include "physics/hydro/hydro_time_step.hpp"
+#include "physics/hydro/primconsflux.hpp"
 #include "physics/material_properties/eos/eos.hpp"
 #include "physics/material_properties/eos/eos_types.hpp"
 #include "physics/material_properties/eos/equation_of_state.hpp"
+#include "physics/material_properties/species_properties.hpp"
 #include "physics/physics_types.hpp"
 #include "utils/instrument.hpp"
 
@@ -31,12 +40,21 @@ std::shared_ptr<KamayanUnit> ProcessUnit() {
 // per species eos parameters
 void SetupSpeciesParams(UnitData &ud, std::string spec) {
   ud.AddParm<std::string>("eos_type", "gamma",
-                          "Equation of state for the " + spec + " species", {"gamma"});
+                          "Equation of state for the " + spec + " species",
+                          {"gamma", "tabulated"});
 
   // gamma law
   ud.AddParm<Real>("gamma", 5.0 / 3.0,
                    "Ratio of specific heats to use in gamma law for the " + spec +
                        " species");
+
+  ud.AddParm<Real>("gamma_ele", 5.0 / 3.0,
+                   "Ratio of specific heats of the electrons in 3T for the " + spec +
+                       " species");
+
+  // tabulated
+  ud.AddParm<std::string>("eos_file", "",
+                          "Table to use for a tabulated eos of the " + spec + " species");
 }
 
 void SetupParams(KamayanUnit *unit) {
@@ -46,6 +64,14 @@ void SetupParams(KamayanUnit *unit) {
   eos.AddParm<std::string>("mode_init", "dens_pres",
                            "eos mode to call after initializing the grid.",
                            {"dens_pres", "dens_ener", "dens_temp"});
+
+  eos.AddParm<bool>("memoize", false,
+                    "Skip the eos after each stage on cells whose density & internal "
+                    "energy are unchanged since their last evaluation. Ignored with "
+                    "multiple species.");
+  eos.AddParm<Real>("memoize_tolerance", 1.0e-12,
+                    "Relative change in the eos inputs below which memoized cells are "
+                    "skipped.");
 }
 
 using supported_eos_options = OptTypeList<OptList<Fluid, Fluid::oneT>>;
@@ -59,46 +85,151 @@ void InitializeData(KamayanUnit *unit) {
                             std::make_pair(EosMode::ener, "dens_ener"),
                             std::make_pair(EosMode::temp, "dens_temp"));
 
-  unit->AddParam("mode_init", mode_init);
-
   // declare vars we will need
   auto fluid = cfg->Get<Fluid>();
   if (fluid == Fluid::oneT) {
     AddFields(EosVariables<Fluid::oneT>(), unit, {Metadata::Cell, Metadata::Overridable});
+  } else {
+    // initialize the components in equilibrium
+    PARTHENON_REQUIRE_THROWS(mode_init != EosMode::pres,
+                             "eos/mode_init=dens_pres is not supported in 3T");
+    if (mode_init == EosMode::temp) mode_init = EosMode::temp_equi;
+    AddFields(EosVariables<Fluid::threeT>(), unit,
+              {Metadata::Cell, Metadata::Overridable});
+  }
+
+  unit->AddParam("mode_init", mode_init);
+
+  // the multi species eos also depends on the mass fractions, which aren't memoized
+  const auto nspecies =
+      strings::split(unit->RuntimeParameters()->Get<std::string>("material", "species"),
+                     ',')
+          .size();
+  const bool memoize =
+      unit->Data("eos").Get<bool>("memoize") && fluid == Fluid::oneT && nspecies == 1;
+  if (memoize) {
+    // each stage keeps its own copy next to the eos outputs it memoizes. Never
+    // communicated or refined, so new blocks are always evaluated
+    AddField<EOS_MEMO>(unit, {Metadata::Cell}, {2});
   }
+  unit->AddParam("memoize", memoize);
+  unit->AddParam("memoize_tolerance", unit->Data("eos").Get<Real>("memoize_tolerance"));
+}
+
+// the electron eos is only built for 3T
+template <Fluid fluid>
+ElectronEos GetElectronEos(const StateDescriptor *material_pkg) {
+  if constexpr (fluid == Fluid::threeT) {
+    return material_pkg->Param<ElectronEos>("eos_ele");
+  } else {
+    return ElectronEos();
+  }
+}
+
+// call the eos on every component of the fluid in a single cell
+template <Fluid fluid, EosMode mode, typename EOS, typename Container>
+KOKKOS_INLINE_FUNCTION void FluidCall(const EOS &eos, const ElectronEos &eos_ele,
+                                      const parthenon::team_mbr_t &member,
+                                      const int scratch_level, Container &indexer) {
+  if constexpr (fluid == Fluid::oneT) {
+    CallWithScratch<EosComponent::oneT, mode>(eos, member, scratch_level, indexer);
+  } else {
+    ThreeTCall<mode>(eos, eos_ele, indexer);
+  }
+}
+
+// the hook of whichever unit registered one
+std::optional<FusedTimeStepHook> GetFusedTimeStepHook(MeshData *md) {
+  for (const auto &[name, pkg] : md->GetMeshPointer()->packages.AllPackages()) {
+    if (pkg->AllParams().hasKey("fused_timestep_hook")) {
+      return pkg->Param<FusedTimeStepHook>("fused_timestep_hook");
+    }
+  }
+  return std::nullopt;
 }
 
 template <Fluid fluid>
 struct EosWrappedImpl {
-  using options = OptTypeList<EosModeOptions<fluid>>;
-  using eos_vars = EosVariables<fluid>;
+  using options = OptTypeList<EosModeOptions<fluid>, MhdOptions, EosModelOptions>;
+  using eos_vars = EosPackVariables<fluid>;
   using value = void;
 
-  template <EosMode mode>
+  template <EosMode mode, Mhd mhd, EosModel model>
   value dispatch(MeshData *md) {
     auto material_pkg = md->GetMeshPointer()->packages.Get("material");
-    auto eos = material_pkg->Param<EOS_t>("eos");
+    auto eos =
+        material_pkg->Param<EOS_t>("eos").template Get<EquationOfState<model>>();
+    auto eos_ele = GetElectronEos<fluid>(material_pkg.get());
     auto pack = grid::GetPack(eos_vars(), md);
+    // the multi species eos needs the species packed on each block
+    const auto species_ids = model == EosModel::multitype ? material::MakeSpeciesIds(md)
+                                                          : material::SpeciesIds();
+    auto eos_pkg = md->GetMeshPointer()->packages.Get("eos");
+    const bool memoize = mode == EosMode::ener && eos_pkg->Param<bool>("memoize");
+    const Real memoize_tol = eos_pkg->Param<Real>("memoize_tolerance");
+    // hydro may have us cache the fast speeds while the eos vars are fresh, and
+    // find the timestep at the end of the final stage
+    const bool cache_speeds =
+        md->GetMeshPointer()->resolved_packages->FieldPresent(CFAST::name());
+    const auto fused_dt_hook = GetFusedTimeStepHook(md);
+    const bool fuse_dt = fused_dt_hook && fused_dt_hook->fuse(md);
+    using hydro_vars =
+        ConcatTypeLists_t<TypeList<DENS, VELOCITY, BMOD, MAGC, CFAST>, grid::CoordFields>;
+    // only built when hydro asks for them, so plain eos calls don't pay for the pack
+    // & the device reduction target
+    decltype(grid::GetPack(hydro_vars(), md)) hydro_pack;
+    if (cache_speeds || fuse_dt) hydro_pack = grid::GetPack(hydro_vars(), md);
+    Kokkos::View<Real> dt_min;
+    if (fuse_dt) {
+      dt_min = Kokkos::View<Real>("dt_min");
+      Kokkos::deep_copy(dt_min, std::numeric_limits<Real>::max());
+    }
+    const auto geometry = GetConfig(md)->Get<Geometry>();
+    const int ndim = md->GetNDim();
 
     auto ib = md->GetBoundsI(parthenon::IndexDomain::interior);
     auto jb = md->GetBoundsJ(parthenon::IndexDomain::interior);
     auto kb = md->GetBoundsK(parthenon::IndexDomain::interior);
 
     const int scratch_level = 0;
-    std::size_t scratch_size_in_bytes = ScratchPad1D::shmem_size(eos.nlambda());
+    std::size_t scratch_size_in_bytes = LambdaScratchSize(eos);
 
     parthenon::par_for_outer(
         PARTHENON_AUTO_LABEL, (ib.e - ib.s) * scratch_size_in_bytes, scratch_level, 0,
         pack.GetNBlocks() - 1, kb.s, kb.e, jb.s, jb.e,
         KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int &b, const int &k,
                       const int &j) {
-          parthenon::par_for_inner(member, ib.s, ib.e, [&](const int &i) {
-            ScratchPad1D lambda_view(member.team_scratch(scratch_level), eos.nlambda());
-            auto lambda = ViewIndexer(lambda_view);
-            auto indexer = SubPack(pack, b, k, j, i);
-            eos.template Call<EosComponent::oneT, mode>(indexer, lambda);
-          });
+          Real row_dt;
+          parthenon::par_reduce_inner(
+              parthenon::inner_loop_pattern_ttr_tag, member, ib.s, ib.e,
+              [&](const int &i, Real &dt_local) {
+                auto indexer =
+                    material::SpeciesIndexer(SubPack(pack, b, k, j, i), species_ids, b);
+                if (!memoize || !MemoizedInputsMatch(indexer, memoize_tol)) {
+                  FluidCall<fluid, mode>(eos, eos_ele, member, scratch_level, indexer);
+                }
+                if (cache_speeds || fuse_dt) {
+                  auto V = SubPack(hydro_pack, b, k, j, i);
+                  if (cache_speeds) hydro::CacheFastSpeed<mhd>(V);
+                  if (fuse_dt) {
+                    const auto coords =
+                        grid::GenericCoordinatePack(geometry, hydro_pack, b);
+                    dt_local = Kokkos::min(
+                        dt_local, hydro::CellTimeStep<mhd>(
+                                      V, coords, ndim, geometry == Geometry::cylindrical,
+                                      cache_speeds, k, j, i));
+                  }
+                }
+              },
+              Kokkos::Min<Real>(row_dt));
+          if (fuse_dt) Kokkos::atomic_min(&dt_min(), row_dt);
         });
+
+    if (fuse_dt) {
+      Real dt;
+      Kokkos::deep_copy(dt, dt_min);
+      fused_dt_hook->set(md, dt);
+    }
   }
 };
 
@@ -106,25 +237,33 @@ TaskStatus EosWrapped(MeshData *md, EosMode mode) {
   auto config = GetConfig(md);
   auto fluid = config->Get<Fluid>();
   if (fluid == Fluid::oneT) {
-    Dispatcher<EosWrappedImpl<Fluid::oneT>>(PARTHENON_AUTO_LABEL, mode).execute(md);
+    Dispatcher<EosWrappedImpl<Fluid::oneT>>(PARTHENON_AUTO_LABEL, mode,
+                                            config->Get<Mhd>(), config->Get<EosModel>())
+        .execute(md);
   } else {
-    PARTHENON_FAIL("ThreeT eos not implemented")
+    Dispatcher<EosWrappedImpl<Fluid::threeT>>(PARTHENON_AUTO_LABEL, mode,
+                                              config->Get<Mhd>(), config->Get<EosModel>())
+        .execute(md);
   }
   return TaskStatus::complete;
 }
 
 template <Fluid fluid>
 struct EosWrappedBlkImpl {
-  using eos_vars = EosVariables<fluid>;
-  using options = OptTypeList<EosModeOptions<fluid>>;
+  using eos_vars = EosPackVariables<fluid>;
+  using options = OptTypeList<EosModeOptions<fluid>, EosModelOptions>;
   using value = void;
 
-  template <EosMode mode>
+  template <EosMode mode, EosModel model>
   value dispatch(MeshBlock *mb) {
     auto material_pkg = mb->packages.Get("material");
-    auto eos = material_pkg->Param<EOS_t>("eos");
+    auto eos =
+        material_pkg->Param<EOS_t>("eos").template Get<EquationOfState<model>>();
+    auto eos_ele = GetElectronEos<fluid>(material_pkg.get());
 
     auto pack = grid::GetPack(eos_vars(), mb);
+    const auto species_ids = model == EosModel::multitype ? material::MakeSpeciesIds(mb)
+                                                          : material::SpeciesIds();
 
     auto cellbounds = mb->cellbounds;
     auto ib = cellbounds.GetBoundsI(parthenon::IndexDomain::interior);
@@ -132,17 +271,16 @@ struct EosWrappedBlkImpl {
     auto kb = cellbounds.GetBoundsK(parthenon::IndexDomain::interior);
 
     const int scratch_level = 0;
-    std::size_t scratch_size_in_bytes = ScratchPad1D::shmem_size(eos.nlambda());
+    std::size_t scratch_size_in_bytes = LambdaScratchSize(eos);
 
     parthenon::par_for_outer(
         PARTHENON_AUTO_LABEL, (ib.e - ib.s) * scratch_size_in_bytes, scratch_level, kb.s,
         kb.e, jb.s, jb.e,
         KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int &k, const int &j) {
           parthenon::par_for_inner(member, ib.s, ib.e, [&](const int &i) {
-            ScratchPad1D lambda_view(member.team_scratch(scratch_level), eos.nlambda());
-            auto lambda = ViewIndexer(lambda_view);
-            auto indexer = SubPack(pack, 0, k, j, i);
-            eos.template Call<EosComponent::oneT, mode>(indexer, lambda);
+            auto indexer =
+                material::SpeciesIndexer(SubPack(pack, 0, k, j, i), species_ids, 0);
+            FluidCall<fluid, mode>(eos, eos_ele, member, scratch_level, indexer);
           });
         });
   }
@@ -156,12 +294,18 @@ TaskStatus EosWrapped(MeshBlock *mb, EosMode mode) {
                                                config->Get<EosModel>(), mode)
         .execute(mb);
   } else {
-    PARTHENON_FAIL("ThreeT eos not implemented")
+    Dispatcher<EosWrappedBlkImpl<Fluid::threeT>>(
+        PARTHENON_AUTO_LABEL, config->Get<Fluid>(), config->Get<EosModel>(), mode)
+        .execute(mb);
   }
   return TaskStatus::complete;
 }
 
-TaskStatus PreparePrimitive(MeshData *md) { return EosWrapped(md, EosMode::ener); }
+TaskStatus PreparePrimitive(MeshData *md) {
+  // in 3T the components are evolved, and the totals are gathered from them
+  const auto fluid = GetConfig(md)->Get<Fluid>();
+  return EosWrapped(md, fluid == Fluid::threeT ? EosMode::ei_gather : EosMode::ener);
+}
 TaskStatus PrepareConserved(MeshData *md) {
   auto eos_pkg = md->GetMeshPointer()->packages.Get("eos");
   return EosWrapped(md, eos_pkg->Param<EosMode>("mode_init"));
@@ -170,14 +314,10 @@ TaskStatus PrepareConserved(MeshData *md) {
 EOS_t MakeEos(std::vector<std::string> species, KamayanUnit *material_unit) {
   auto config = material_unit->Configuration();
   auto fluid = config->Get<Fluid>();
-  if (species.size() > 1) {
-    // build a multispecies eos and return it
-  }
-  if (fluid == Fluid::threeT) {
-  } else {
-    return EOS_t(MakeEosSingleSpecies(species[0], material_unit));
-  }
-  return EOS_t();
+  PARTHENON_REQUIRE_THROWS(fluid == Fluid::oneT || species.size() == 1,
+                           "3T only supports a single species");
+  if (species.size() > 1) return EOS_t(MakeEosMultiSpecies(species, material_unit));
+  return EOS_t(MakeEosSingleSpecies(species[0], material_unit));
 }
 
 }  // namespace kamayan::eos
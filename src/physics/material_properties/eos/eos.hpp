@@ -32,7 +32,7 @@ TaskStatus PrepareConserved(MeshData *md);
 // Add all parameters needed for a single species' eos
 void SetupSpeciesParams(UnitData &ud, std::string spec);
 // build an equation of state for a list of species
-EOS_t MakeEos(std::vector<std::string> species);
+EOS_t MakeEos(std::vector<std::string> species, KamayanUnit *material_unit);
 
 }  // namespace kamayan::eos
 
@@ -0,0 +1,75 @@
+#include "physics/material_properties/eos/eos_table.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/error_checking.hpp"
+
+namespace kamayan::eos {
+
+EosTable::EosTable(const Real lrho_min, const Real lrho_max, const int nrho,
+                   const Real ltemp_min, const Real ltemp_max, const int ntemp,
+                   const std::vector<Real> &nodes)
+    : lrho_min_(lrho_min), dlrho_((lrho_max - lrho_min) / (nrho - 1)),
+      ltemp_min_(ltemp_min), dltemp_((ltemp_max - ltemp_min) / (ntemp - 1)),
+      nrho_(nrho), ntemp_(ntemp) {
+  PARTHENON_REQUIRE_THROWS(nrho > 1 && ntemp > 1,
+                           "eos tables need at least two nodes along each axis");
+  PARTHENON_REQUIRE_THROWS(nodes.size() == nvars * nrho * ntemp,
+                           "eos table has the wrong number of nodes");
+  nbisect_ = static_cast<int>(std::ceil(std::log2(ntemp - 1)));
+
+  Kokkos::View<Real *> data("eos_table", (nrho - 1) * (ntemp - 1) * stride);
+  auto data_h = Kokkos::create_mirror_view(data);
+  const auto node = [&](const int ir, const int it, const int var) {
+    return nodes[(ir * ntemp + it) * nvars + var];
+  };  // NOLINT(readability/braces)
+  for (int ir = 0; ir < nrho - 1; ir++) {
+    for (int it = 0; it < ntemp - 1; it++) {
+      Real *cell = &data_h((ir * (ntemp - 1) + it) * stride);
+      for (int var = 0; var < nvars; var++) {
+        cell[var * ncorners + 0] = node(ir, it, var);
+        cell[var * ncorners + 1] = node(ir + 1, it, var);
+        cell[var * ncorners + 2] = node(ir, it + 1, var);
+        cell[var * ncorners + 3] = node(ir + 1, it + 1, var);
+      }
+    }
+  }
+  Kokkos::deep_copy(data, data_h);
+  data_ = data;
+}
+
+EosTable LoadEosTable(const std::string &filename) {
+  static std::mutex mutex;
+  static std::map<std::string, EosTable> tables;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (tables.count(filename) > 0) return tables.at(filename);
+
+  std::ifstream file(filename);
+  PARTHENON_REQUIRE_THROWS(file.is_open(), "Could not open eos table " + filename);
+  int nrho, ntemp;
+  Real lrho_min, lrho_max, ltemp_min, ltemp_max;
+  file >> nrho >> ntemp >> lrho_min >> lrho_max >> ltemp_min >> ltemp_max;
+  PARTHENON_REQUIRE_THROWS(!file.fail(), "Failed reading eos table " + filename);
+
+  std::vector<Real> nodes(EosTable::nvars * nrho * ntemp);
+  for (auto &value : nodes) {
+    file >> value;
+    PARTHENON_REQUIRE_THROWS(!file.fail(), "Failed reading eos table " + filename);
+    PARTHENON_REQUIRE_THROWS(value > 0.0,
+                             "eos table " + filename + " needs positive values");
+    value = std::log10(value);
+  }
+
+  // the views need to be released before kokkos is finalized
+  if (tables.empty()) Kokkos::push_finalize_hook([] { tables.clear(); });
+  tables[filename] =
+      EosTable(lrho_min, lrho_max, nrho, ltemp_min, ltemp_max, ntemp, nodes);
+  return tables.at(filename);
+}
+
+}  // namespace kamayan::eos
@@ -0,0 +1,107 @@
+#ifndef PHYSICS_MATERIAL_PROPERTIES_EOS_EOS_TABLE_HPP_
+#define PHYSICS_MATERIAL_PROPERTIES_EOS_EOS_TABLE_HPP_
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "grid/grid_types.hpp"
+#include "kamayan_utils/robust.hpp"
+
+namespace kamayan::eos {
+
+// eos tabulated on a uniform grid in log10 rho & log10 T. Every cell of the table
+// holds the log10 of eint, pres & bmod at all four of its corners next to each other,
+// so a bilinear lookup only reads 96 contiguous bytes, at most two cache lines.
+// This duplicates each node four times, but the tables are small next to the mesh
+class EosTable {
+ public:
+  enum Var { eint = 0, pres = 1, bmod = 2 };
+  static constexpr int nvars = 3;
+  static constexpr int ncorners = 4;
+  static constexpr int stride = nvars * ncorners;
+
+  EosTable() = default;
+
+  // nodes holds the log10 of each Var at every node, with the vars fastest then
+  // temperature & density slowest
+  EosTable(const Real lrho_min, const Real lrho_max, const int nrho, const Real ltemp_min,
+           const Real ltemp_max, const int ntemp, const std::vector<Real> &nodes);
+
+  // bracketing cell & weight along either axis
+  KOKKOS_INLINE_FUNCTION void RhoCell(const Real lrho, int &ir, Real &wr) const {
+    Cell(lrho, lrho_min_, dlrho_, nrho_, ir, wr);
+  }
+  KOKKOS_INLINE_FUNCTION void TempCell(const Real ltemp, int &it, Real &wt) const {
+    Cell(ltemp, ltemp_min_, dltemp_, ntemp_, it, wt);
+  }
+
+  KOKKOS_INLINE_FUNCTION Real LogTemp(const int it, const Real wt) const {
+    return ltemp_min_ + (it + wt) * dltemp_;
+  }
+
+  // bilinear interpolation of var inside table cell (ir, it)
+  KOKKOS_INLINE_FUNCTION Real Value(const int ir, const Real wr, const int it,
+                                    const Real wt, const Var var) const {
+    const int c = (ir * (ntemp_ - 1) + it) * stride + var * ncorners;
+    return (1.0 - wt) * ((1.0 - wr) * data_(c) + wr * data_(c + 1)) +
+           wt * ((1.0 - wr) * data_(c + 2) + wr * data_(c + 3));
+  }
+
+  // d log10(var) / d log10(T) at fixed density
+  KOKKOS_INLINE_FUNCTION Real DLogDLogT(const int ir, const Real wr, const int it,
+                                        const Var var) const {
+    return (Value(ir, wr, it, 1.0, var) - Value(ir, wr, it, 0.0, var)) / dltemp_;
+  }
+
+  // find the temperature cell where var takes the value lvar at fixed density.
+  // Bisection over the temperature nodes always takes the same number of steps so
+  // neighboring cells stay in lock step, after which the bilinear interpolant is
+  // linear in wt and can be inverted exactly
+  KOKKOS_INLINE_FUNCTION void InverseTemp(const int ir, const Real wr, const Var var,
+                                          const Real lvar, int &it, Real &wt) const {
+    int lo = 0;
+    int hi = ntemp_ - 1;
+    for (int iter = 0; iter < nbisect_; iter++) {
+      const int mid = (lo + hi) / 2;
+      const bool above = Node(ir, wr, mid, var) <= lvar;
+      lo = above ? mid : lo;
+      hi = above ? hi : mid;
+    }
+    it = Kokkos::min(lo, ntemp_ - 2);
+    const Real v0 = Value(ir, wr, it, 0.0, var);
+    const Real v1 = Value(ir, wr, it, 1.0, var);
+    wt = utils::Ratio(lvar - v0, v1 - v0);
+  }
+
+ private:
+  KOKKOS_INLINE_FUNCTION static void Cell(const Real x, const Real x_min, const Real dx,
+                                          const int n, int &idx, Real &w) {
+    const Real s = (x - x_min) / dx;
+    // clamp to the edge cells, which then extrapolate linearly
+    idx = Kokkos::min(Kokkos::max(static_cast<int>(Kokkos::floor(s)), 0), n - 2);
+    w = s - idx;
+  }
+
+  // var at temperature node it
+  KOKKOS_INLINE_FUNCTION Real Node(const int ir, const Real wr, const int it,
+                                   const Var var) const {
+    const int cell = Kokkos::min(it, ntemp_ - 2);
+    return Value(ir, wr, cell, it - cell, var);
+  }
+
+  Real lrho_min_, dlrho_, ltemp_min_, dltemp_;
+  int nrho_, ntemp_, nbisect_;
+  Kokkos::View<const Real *, Kokkos::MemoryTraits<Kokkos::RandomAccess>> data_;
+};
+
+// read a table from file, each table is only read once per rank & shared by every
+// eos that uses it. The file is plain text with
+//   nrho ntemp
+//   log10(rho_min) log10(rho_max) log10(T_min) log10(T_max)
+// followed by eint pres bmod on each line for every node, temperature fastest
+EosTable LoadEosTable(const std::string &filename);
+
+}  // namespace kamayan::eos
+
+#endif  // PHYSICS_MATERIAL_PROPERTIES_EOS_EOS_TABLE_HPP_
@@ -1,12 +1,16 @@
 #ifndef PHYSICS_MATERIAL_PROPERTIES_EOS_EOS_TYPES_HPP_
 #define PHYSICS_MATERIAL_PROPERTIES_EOS_EOS_TYPES_HPP_
 #include <concepts>
+#include <functional>
+
+#include <Kokkos_Core.hpp>
 
 #include "dispatcher/options.hpp"
 #include "grid/grid_types.hpp"
 #include "kamayan/fields.hpp"
 #include "kamayan_utils/type_abstractions.hpp"
 #include "kamayan_utils/type_list.hpp"
+#include "physics/material_properties/material_types.hpp"
 #include "physics/physics_types.hpp"
 
 namespace kamayan {
@@ -25,8 +29,12 @@ concept AccessorLike = requires(T obj) {
   { &obj[int()] } -> std::convertible_to<Real *>;
 };
 
+// lambda for eos that don't use one
 struct NullIndexer {
-  Real *operator[](int i) { return nullptr; }
+  KOKKOS_INLINE_FUNCTION Real &operator[](int i) { return null_; }
+
+ private:
+  Real null_;
 };
 
 // Use these as scratch space in singularityEoS' lambda argument. These
@@ -40,6 +48,26 @@ struct ViewIndexer {
   View_t data_;
 };
 
+// DENS & EINT of the last ener mode call on each cell, when eos/memoize is set
+using EOS_MEMO = VariableBase<"eos_memo", VariableRank::scalar, 2>;
+
+// with memoization an ener mode call can be skipped while its inputs haven't changed
+// to within tol since the last call, otherwise they are saved for the next one. Only
+// DENS & EINT are compared, so this can't be used for an eos of the mass fractions
+template <typename Indexer>
+KOKKOS_INLINE_FUNCTION bool MemoizedInputsMatch(Indexer &indexer, const Real tol) {
+  const Real dens = indexer(DENS());
+  const Real eint = indexer(EINT());
+  const bool match =
+      Kokkos::abs(dens - indexer(EOS_MEMO(0))) <= tol * Kokkos::abs(dens) &&
+      Kokkos::abs(eint - indexer(EOS_MEMO(1))) <= tol * Kokkos::abs(eint);
+  if (!match) {
+    indexer(EOS_MEMO(0)) = dens;
+    indexer(EOS_MEMO(1)) = eint;
+  }
+  return match;
+}
+
 template <EosComponent>
 struct EosVars {};
 
@@ -83,8 +111,9 @@ auto constexpr EosVarsImpl() {
   if constexpr (fluid == Fluid::oneT) {
     return EosVars<EosComponent::oneT>::types();
   } else {
-    return ConcatTypeLists_t<EosVars<EosComponent::ion>::types,
-                             EosVars<EosComponent::ele>::types>();
+    // totals followed by the ion & electron components, which share DENS & BMOD
+    return ConcatTypeLists_t<EosVars<EosComponent::oneT>::types,
+                             TypeList<TION, EION, PION, TELE, EELE, PELE>>();
   }
 }
 }  // namespace impl
@@ -92,6 +121,11 @@ template <Fluid fluid>
 using EosModeOptions = decltype(impl::EosModes<fluid>());
 template <Fluid fluid>
 using EosVariables = decltype(impl::EosVarsImpl<fluid>());
+// variables packed for eos kernels, mass fractions are only used by a multi species eos
+// & the memoized inputs when eos/memoize is set
+template <Fluid fluid>
+using EosPackVariables =
+    ConcatTypeLists_t<EosVariables<fluid>, TypeList<material::MFRAC, EOS_MEMO>>;
 
 template <Fluid, EosClosure>
 struct EosTraits {};
@@ -110,6 +144,14 @@ struct EosFactory : OptionFactory {
   using type = EosFactory;
 };
 
+// a unit can have its timestep found in the final stage eos pass, while the eos vars
+// are fresh, by adding one of these as the fused_timestep_hook param of its package.
+// fuse says whether the pass over md should find the timestep, which is handed to set
+struct FusedTimeStepHook {
+  std::function<bool(MeshData *md)> fuse;
+  std::function<void(MeshData *md, const Real dt)> set;
+};
+
 }  // namespace eos
 }  // namespace kamayan
 
@@ -1,13 +1,18 @@
 #include "equation_of_state.hpp"
 
 #include <string>
+#include <vector>
 
 namespace kamayan::eos {
 
 EosVariant MakeEosSingleSpecies(std::string spec, KamayanUnit *material) {
   auto get_block = [&](const std::string &key) { return "material/" + spec + "/" + key; };
   auto eos_type = material->Param<std::string>(get_block("eos_type"));
-  // currently only support gamma law so just build that
+  if (eos_type == "tabulated") {
+    return EquationOfState<EosModel::tabulated>(
+        LoadEosTable(material->Param<std::string>(get_block("eos_file"))));
+  }
+
   auto Abar = material->Param<Real>(get_block("Abar"));
   auto Z = material->Param<Real>(get_block("Z"));
   auto gamma = material->Param<Real>(get_block("gamma"));
@@ -17,4 +22,25 @@ EosVariant MakeEosSingleSpecies(std::string spec, KamayanUnit *material) {
   }
   return EquationOfState<EosModel::gamma>(gamma, Abar);
 }
+
+ElectronEos MakeEosElectrons(std::string spec, KamayanUnit *material) {
+  auto get_block = [&](const std::string &key) { return "material/" + spec + "/" + key; };
+  auto Abar = material->Param<Real>(get_block("Abar"));
+  auto Z = material->Param<Real>(get_block("Z"));
+  auto gamma = material->Param<Real>(get_block("gamma_ele"));
+  // Z electrons for every ion
+  return ElectronEos(gamma, Abar / Z);
+}
+
+EosVariant MakeEosMultiSpecies(const std::vector<std::string> &species,
+                               KamayanUnit *material) {
+  for (const auto &spec : species) {
+    PARTHENON_REQUIRE_THROWS(
+        material->Param<std::string>("material/" + spec + "/eos_type") == "gamma",
+        "Only gamma law species are supported in a multi species eos");
+  }
+  // share the species properties with the rest of the material
+  return EquationOfState<EosModel::multitype>(
+      material->Param<material::SpeciesProperties>("species_properties"));
+}
 }  // namespace kamayan::eos
@@ -1,19 +1,27 @@
 #ifndef PHYSICS_MATERIAL_PROPERTIES_EOS_EQUATION_OF_STATE_HPP_
 #define PHYSICS_MATERIAL_PROPERTIES_EOS_EQUATION_OF_STATE_HPP_
 #include <cmath>
+#include <cstddef>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
-#include <singularity-eos/eos/eos_ideal.hpp>
 
+#include "dispatcher/options.hpp"
+#include "grid/grid_types.hpp"
 #include "kamayan/fields.hpp"
+#include "kamayan_utils/robust.hpp"
 #include "kamayan/unit.hpp"
 #include "physics/material_properties/eos/eos_singularity.hpp"
+#include "physics/material_properties/eos/eos_table.hpp"
 #include "physics/material_properties/eos/eos_types.hpp"
+#include "physics/material_properties/material_types.hpp"
+#include "physics/material_properties/species_properties.hpp"
 #include "physics/physics_types.hpp"
+#include "kokkos_abstraction.hpp"
 #include "ports-of-call/variant.hpp"
-#include "singularity-eos/base/robust_utils.hpp"
 
 namespace kamayan::eos {
 
@@ -29,46 +37,181 @@ struct EquationOfState {};
 
 template <>
 struct EquationOfState<EosModel::gamma> {
+  static constexpr EosModel model = EosModel::gamma;
   static constexpr Kokkos::Array<EosMode, 3> modes{
       EosMode::ener,
       EosMode::pres,
       EosMode::temp,
   };
+  // closed form, so no scratch is needed for singularity's lambda
+  static constexpr bool needs_lambda = false;
 
   EquationOfState() = default;
 
-  EquationOfState(const Real &gamma, const Real &Abar) {
-    // singularity uses Gruneisen parameter & heat capacity (gamma * Kt / abar)
-    // TODO(acreyes) : some kind of physical constants...
-    // probably should be a struct with static constexpr...
-    constexpr Real kboltz = 1.380649e-16;
-    const Real cv = gamma * kboltz / Abar;
-    eos_ = singularity::IdealGas(gamma - 1.0, cv);
-  }
+  EquationOfState(const Real &gamma, const Real &Abar)
+      : gamma_(gamma), cv_(GammaLawCv(gamma, Abar)) {}
 
   template <EosComponent component, EosMode mode, typename Container, typename... Ts,
             typename Lambda = NullIndexer>
   requires(AccessorLike<Lambda>)
   // requires(AccessorLike<Lambda>, IndexerLike<Container<Ts...>, Ts...>)
   KOKKOS_INLINE_FUNCTION Real Call(Container &indexer, Lambda lambda = Lambda()) const {
-    constexpr auto output = SingularityEosFill<mode>::output;
     using vars = EosVars<component>;
     using eint = typename vars::eint;
     using temp = typename vars::temp;
     using pres = typename vars::pres;
-    Real cv;
-    eos_.FillEos(indexer(DENS()), indexer(typename vars::temp()),
-                 indexer(typename vars::eint()), indexer(typename vars::pres()), cv,
-                 indexer(BMOD()), output, lambda);
+    const Real dens = indexer(DENS());
+    if constexpr (mode == EosMode::ener) {
+      indexer(temp()) = utils::Ratio(indexer(eint()), cv_);
+      indexer(pres()) = (gamma_ - 1.0) * dens * indexer(eint());
+    } else if constexpr (mode == EosMode::pres) {
+      indexer(eint()) = utils::Ratio(indexer(pres()), (gamma_ - 1.0) * dens);
+      indexer(temp()) = utils::Ratio(indexer(eint()), cv_);
+    } else if constexpr (mode == EosMode::temp) {
+      indexer(eint()) = cv_ * indexer(temp());
+      indexer(pres()) = (gamma_ - 1.0) * dens * indexer(eint());
+    }
+    indexer(BMOD()) = gamma_ * indexer(pres());
+    return cv_;
+  }
+
+  KOKKOS_INLINE_FUNCTION static constexpr int nlambda() { return 0; }
+
+ private:
+  Real gamma_, cv_;
+};
+
+template <>
+struct EquationOfState<EosModel::tabulated> {
+  static constexpr EosModel model = EosModel::tabulated;
+  static constexpr Kokkos::Array<EosMode, 3> modes{
+      EosMode::ener,
+      EosMode::pres,
+      EosMode::temp,
+  };
+  static constexpr bool needs_lambda = false;
+
+  EquationOfState() = default;
+  explicit EquationOfState(const EosTable &table) : table_(table) {}
+
+  template <EosComponent component, EosMode mode, typename Container, typename... Ts,
+            typename Lambda = NullIndexer>
+  requires(AccessorLike<Lambda>)
+  KOKKOS_INLINE_FUNCTION Real Call(Container &indexer, Lambda lambda = Lambda()) const {
+    using vars = EosVars<component>;
+    using eint = typename vars::eint;
+    using temp = typename vars::temp;
+    using pres = typename vars::pres;
+    using Var = EosTable::Var;
+    int ir, it;
+    Real wr, wt;
+    table_.RhoCell(Kokkos::log10(indexer(DENS())), ir, wr);
+    if constexpr (mode == EosMode::temp) {
+      table_.TempCell(Kokkos::log10(indexer(temp())), it, wt);
+    } else {
+      // ener & pres need the temperature where the table matches the input
+      constexpr Var input = mode == EosMode::ener ? Var::eint : Var::pres;
+      const Real lvar =
+          Kokkos::log10(mode == EosMode::ener ? indexer(eint()) : indexer(pres()));
+      table_.InverseTemp(ir, wr, input, lvar, it, wt);
+      indexer(temp()) = Kokkos::pow(10.0, table_.LogTemp(it, wt));
+    }
+    if constexpr (mode != EosMode::ener) {
+      indexer(eint()) = Kokkos::pow(10.0, table_.Value(ir, wr, it, wt, Var::eint));
+    }
+    if constexpr (mode != EosMode::pres) {
+      indexer(pres()) = Kokkos::pow(10.0, table_.Value(ir, wr, it, wt, Var::pres));
+    }
+    indexer(BMOD()) = Kokkos::pow(10.0, table_.Value(ir, wr, it, wt, Var::bmod));
+    return utils::Ratio(indexer(eint()), indexer(temp())) *
+           table_.DLogDLogT(ir, wr, it, Var::eint);
+  }
+
+  KOKKOS_INLINE_FUNCTION static constexpr int nlambda() { return 0; }
+
+ private:
+  EosTable table_;
+};
+
+// mixture of gamma law species with a Dalton closure, where all species share the
+// cell's temperature and their partial energies & pressures add. The per species
+// parameters come from the material's SpeciesProperties and all species of a cell
+// are summed in one loop, so the cost barely grows with the number of species
+template <>
+struct EquationOfState<EosModel::multitype> {
+  static constexpr EosModel model = EosModel::multitype;
+  static constexpr Kokkos::Array<EosMode, 3> modes{
+      EosMode::ener,
+      EosMode::pres,
+      EosMode::temp,
+  };
+  static constexpr bool needs_lambda = false;
+
+  EquationOfState() = default;
+  explicit EquationOfState(const material::SpeciesProperties &species)
+      : species_(species) {}
+
+  // the indexer needs the mass fractions of the species allocated on its block, and
+  // the species each of them belongs to, see material::SpeciesIndexer
+  template <EosComponent component, EosMode mode, typename Container, typename... Ts,
+            typename Lambda = NullIndexer>
+  requires(AccessorLike<Lambda>)
+  KOKKOS_INLINE_FUNCTION Real Call(Container &indexer, Lambda lambda = Lambda()) const {
+    using vars = EosVars<component>;
+    using eint = typename vars::eint;
+    using temp = typename vars::temp;
+    using pres = typename vars::pres;
+    const auto mixture = species_.Mixture(indexer);
+    const Real cv = mixture.cv;
+    const Real gm1_cv = (mixture.gamma - 1.0) * cv;
+
+    const Real dens = indexer(DENS());
+    if constexpr (mode == EosMode::ener) {
+      indexer(temp()) = utils::Ratio(indexer(eint()), cv);
+    } else if constexpr (mode == EosMode::pres) {
+      indexer(temp()) = utils::Ratio(indexer(pres()), dens * gm1_cv);
+    }
+    if constexpr (mode != EosMode::ener) indexer(eint()) = cv * indexer(temp());
+    if constexpr (mode != EosMode::pres) {
+      indexer(pres()) = dens * gm1_cv * indexer(temp());
+    }
+    indexer(BMOD()) = mixture.gamma * indexer(pres());
     return cv;
   }
 
-  KOKKOS_INLINE_FUNCTION auto nlambda() const { return eos_.nlambda(); }
+  KOKKOS_INLINE_FUNCTION static constexpr int nlambda() { return 0; }
 
  private:
-  singularity::IdealGas eos_;
+  material::SpeciesProperties species_;
 };
 
+// call the eos on a single cell, only taking scratch from the team for the lambda
+// when the model needs it
+template <EosComponent component, EosMode mode, typename EOS, typename Container>
+requires(EquationOfStateImplementation<EOS>)
+KOKKOS_INLINE_FUNCTION Real CallWithScratch(const EOS &eos,
+                                            const parthenon::team_mbr_t &member,
+                                            const int scratch_level, Container &indexer) {
+  if constexpr (EOS::needs_lambda) {
+    ScratchPad1D lambda_view(member.team_scratch(scratch_level), eos.nlambda());
+    auto lambda = ViewIndexer(lambda_view);
+    return eos.template Call<component, mode>(indexer, lambda);
+  } else {
+    return eos.template Call<component, mode>(indexer);
+  }
+}
+
+// bytes of scratch needed by CallWithScratch for each cell
+template <typename EOS>
+requires(EquationOfStateImplementation<EOS>)
+std::size_t LambdaScratchSize(const EOS &eos) {
+  if constexpr (EOS::needs_lambda) {
+    return ScratchPad1D::shmem_size(eos.nlambda());
+  } else {
+    return 0;
+  }
+}
+
 // Fluid::oneT overload just calls eos and gets gamc/game
 // Fluid::threeT would take two EOSs and call for ion/electrons separately
 template <Fluid fluid, EosMode mode, typename EOS,
@@ -79,10 +222,89 @@ void EosCall(EOS eos, Container<Ts...> &indexer, Lambda lambda = Lambda()) {
   eos.template Call<EosComponent::oneT, mode>(indexer, lambda);
 }
 
+// electrons are always a gamma law
+using ElectronEos = EquationOfState<EosModel::gamma>;
+
+namespace impl {
+// call the ion & electron eos on the same cell in mode, optionally gathering the
+// component pressures & energies into the totals. Returns the total cv
+template <EosMode mode, bool gather, typename IonEos, typename Container>
+KOKKOS_INLINE_FUNCTION Real CallComponents(const IonEos &ion, const ElectronEos &ele,
+                                           Container &indexer) {
+  const Real cv_ion = ion.template Call<EosComponent::ion, mode>(indexer);
+  const Real bmod_ion = indexer(BMOD());
+  const Real cv_ele = ele.template Call<EosComponent::ele, mode>(indexer);
+  indexer(BMOD()) += bmod_ion;
+  if constexpr (gather) {
+    indexer(EINT()) = indexer(EION()) + indexer(EELE());
+    indexer(PRES()) = indexer(PION()) + indexer(PELE());
+    indexer(TEMP()) = indexer(TION());
+  }
+  return cv_ion + cv_ele;
+}
+}  // namespace impl
+
+// Fluid::threeT calls both components in the same pass over a cell. The mode says
+// how the components relate to the totals
+//   ener        : components in equilibrium with the total EINT
+//   temp_equi   : components at the total TEMP
+//   temp_gather : components at their own temperatures, gathered into the totals
+//   ei          : components from their own energies
+//   ei_gather   : ei, gathered into the totals
+//   ei_scatter  : component energies rescaled to sum to EINT, then ei_gather
+template <EosMode mode, typename IonEos, typename Container>
+requires(EquationOfStateImplementation<IonEos>)
+KOKKOS_INLINE_FUNCTION void ThreeTCall(const IonEos &ion, const ElectronEos &ele,
+                                       Container &indexer) {
+  static_assert(!IonEos::needs_lambda, "3T eos calls don't take a lambda");
+  if constexpr (mode == EosMode::ener) {
+    // newton iteration for the equilibrium temperature, exact for gamma laws
+    constexpr int max_iterations = 20;
+    constexpr Real tolerance = 1.0e-12;
+    const Real eint = indexer(EINT());
+    Real temp = indexer(TEMP()) > 0.0 ? indexer(TEMP()) : 1.0;
+    for (int iter = 0; iter < max_iterations; iter++) {
+      indexer(TION()) = temp;
+      indexer(TELE()) = temp;
+      const Real cv = impl::CallComponents<EosMode::temp, false>(ion, ele, indexer);
+      const Real residual = indexer(EION()) + indexer(EELE()) - eint;
+      if (Kokkos::abs(residual) <= tolerance * Kokkos::abs(eint)) break;
+      temp = Kokkos::max(temp - utils::Ratio(residual, cv), 0.5 * temp);
+    }
+    impl::CallComponents<EosMode::temp, true>(ion, ele, indexer);
+  } else if constexpr (mode == EosMode::temp_equi) {
+    indexer(TION()) = indexer(TEMP());
+    indexer(TELE()) = indexer(TEMP());
+    impl::CallComponents<EosMode::temp, true>(ion, ele, indexer);
+  } else if constexpr (mode == EosMode::temp_gather) {
+    impl::CallComponents<EosMode::temp, true>(ion, ele, indexer);
+  } else if constexpr (mode == EosMode::ei) {
+    impl::CallComponents<EosMode::ener, false>(ion, ele, indexer);
+  } else if constexpr (mode == EosMode::ei_gather) {
+    impl::CallComponents<EosMode::ener, true>(ion, ele, indexer);
+  } else if constexpr (mode == EosMode::ei_scatter) {
+    const Real scale = utils::Ratio(indexer(EINT()), indexer(EION()) + indexer(EELE()));
+    indexer(EION()) *= scale;
+    indexer(EELE()) *= scale;
+    impl::CallComponents<EosMode::ener, true>(ion, ele, indexer);
+  } else {
+    static_assert(mode == EosMode::ener, "unsupported 3T eos mode");
+  }
+}
+
 // need to use portable variant to work on GPU
-using EosVariant = PortsOfCall::variant<EquationOfState<EosModel::gamma>>;
+using EosVariant = PortsOfCall::variant<EquationOfState<EosModel::gamma>,
+                                         EquationOfState<EosModel::tabulated>,
+                                         EquationOfState<EosModel::multitype>>;
+// models held by the EosVariant, kernels dispatch on these to call the concrete
+// EquationOfState rather than visiting the variant in every cell
+using EosModelOptions =
+    OptList<EosModel, EosModel::gamma, EosModel::tabulated, EosModel::multitype>;
 
 EosVariant MakeEosSingleSpecies(std::string spec, KamayanUnit *material);
+EosVariant MakeEosMultiSpecies(const std::vector<std::string> &species,
+                               KamayanUnit *material);
+ElectronEos MakeEosElectrons(std::string spec, KamayanUnit *material);
 
 class EOS_t {
  private:
@@ -114,6 +336,16 @@ class EOS_t {
         eos_);
   }
 
+  template <typename T>
+  KOKKOS_INLINE_FUNCTION const T &Get() const {
+    return PortsOfCall::get<T>(eos_);
+  }
+
+  EosModel Model() const {
+    return PortsOfCall::visit(
+        [](const auto &eos) { return std::decay_t<decltype(eos)>::model; }, eos_);
+  }
+
   KOKKOS_INLINE_FUNCTION int nlambda() const {
     return PortsOfCall::visit([](const auto &eos) { return eos.nlambda(); }, eos_);
   }
@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cmath>
 #include <vector>
 
 #include "kamayan/fields.hpp"
+#include "physics/material_properties/eos/eos_table.hpp"
 #include "physics/material_properties/eos/eos_types.hpp"
 #include "physics/material_properties/eos/equation_of_state.hpp"
+#include "physics/material_properties/material_types.hpp"
+#include "physics/material_properties/species_properties.hpp"
 #include "physics/physics_types.hpp"
 #include "singularity-eos/eos/default_variant.hpp"
 
@@ -84,4 +89,235 @@ TEST(Eos, EOS_t) {
   EXPECT_EQ(eos_data(PRES()), 1.);
 }
 
+TEST(Eos, IdealGasClosedForm) {
+  constexpr Real gamma = 1.4;
+  auto eos = EquationOfState<EosModel::gamma>(gamma, 1.0);
+  EXPECT_EQ(eos.nlambda(), 0);
+  auto eos_arr = std::array<Real, 5>{2., 0., 0., 3., 0.};
+  auto eos_data = EosData<EosComponent::oneT>(eos_arr);
+
+  // no lambda is needed, so the default NullIndexer is used
+  const Real cv = eos.template Call<EosComponent::oneT, EosMode::pres>(eos_data);
+  EXPECT_NEAR(eos_data(EINT()), 3. / (2. * (gamma - 1.)), 1.e-14);
+  EXPECT_NEAR(eos_data(BMOD()), gamma * 3., 1.e-14);
+
+  // temperature should round trip back to the same state
+  const Real temp = eos_data(TEMP());
+  EXPECT_NEAR(temp, eos_data(EINT()) / cv, 1.e-14 * temp);
+  eos_data(PRES()) = -1.;
+  eos_data(EINT()) = -1.;
+  eos.template Call<EosComponent::oneT, EosMode::temp>(eos_data);
+  EXPECT_NEAR(eos_data(EINT()), 3. / (2. * (gamma - 1.)), 1.e-14);
+  EXPECT_NEAR(eos_data(PRES()), 3., 1.e-14);
+}
+
+TEST(Eos, EOS_tModel) {
+  EOS_t eos(EquationOfState<EosModel::gamma>(1.4, 1.0));
+  EXPECT_EQ(eos.Model(), EosModel::gamma);
+
+  auto eos_arr = std::array<Real, 5>{1., 0., 0., 1., 0.};
+  auto eos_data = EosData<EosComponent::oneT>(eos_arr);
+  const auto &gamma_law = eos.template Get<EquationOfState<EosModel::gamma>>();
+  gamma_law.template Call<EosComponent::oneT, EosMode::pres>(eos_data);
+  EXPECT_NEAR(eos_data(EINT()), 1. / 0.4, 1.e-14);
+}
+
+// the gamma law is linear in log rho & log T, so interpolating a table of it in
+// log space should reproduce it exactly
+TEST(Eos, TabulatedGammaLaw) {
+  constexpr Real gamma = 1.4;
+  auto gamma_law = EquationOfState<EosModel::gamma>(gamma, 1.0);
+  constexpr int nrho = 9, ntemp = 17;
+  constexpr Real lrho_min = -2., lrho_max = 2., ltemp_min = 2., ltemp_max = 6.;
+  std::vector<Real> nodes;
+  for (int ir = 0; ir < nrho; ir++) {
+    for (int it = 0; it < ntemp; it++) {
+      const Real lrho = lrho_min + ir * (lrho_max - lrho_min) / (nrho - 1);
+      const Real ltemp = ltemp_min + it * (ltemp_max - ltemp_min) / (ntemp - 1);
+      auto eos_arr = std::array<Real, 5>{std::pow(10., lrho), std::pow(10., ltemp)};
+      auto eos_data = EosData<EosComponent::oneT>(eos_arr);
+      gamma_law.template Call<EosComponent::oneT, EosMode::temp>(eos_data);
+      for (const Real value : {eos_data(EINT()), eos_data(PRES()), eos_data(BMOD())}) {
+        nodes.push_back(std::log10(value));
+      }
+    }
+  }
+  auto tabulated = EquationOfState<EosModel::tabulated>(
+      EosTable(lrho_min, lrho_max, nrho, ltemp_min, ltemp_max, ntemp, nodes));
+
+  for (const Real dens : {0.013, 0.7, 42.}) {
+    for (const Real temp : {170., 3.3e3, 8.1e5}) {
+      auto expected_arr = std::array<Real, 5>{dens, temp};
+      auto expected = EosData<EosComponent::oneT>(expected_arr);
+      const Real cv =
+          gamma_law.template Call<EosComponent::oneT, EosMode::temp>(expected);
+
+      const auto check = [&](auto &eos_data, const Real tabulated_cv) {
+        EXPECT_NEAR(eos_data(TEMP()), expected(TEMP()), 1.e-10 * expected(TEMP()));
+        EXPECT_NEAR(eos_data(EINT()), expected(EINT()), 1.e-10 * expected(EINT()));
+        EXPECT_NEAR(eos_data(PRES()), expected(PRES()), 1.e-10 * expected(PRES()));
+        EXPECT_NEAR(eos_data(BMOD()), expected(BMOD()), 1.e-10 * expected(BMOD()));
+        EXPECT_NEAR(tabulated_cv, cv, 1.e-10 * cv);
+      };  // NOLINT(readability/braces)
+
+      auto temp_arr = std::array<Real, 5>{dens, temp};
+      auto temp_data = EosData<EosComponent::oneT>(temp_arr);
+      check(temp_data,
+            tabulated.template Call<EosComponent::oneT, EosMode::temp>(temp_data));
+
+      auto ener_arr = std::array<Real, 5>{dens, 0., expected(EINT())};
+      auto ener_data = EosData<EosComponent::oneT>(ener_arr);
+      check(ener_data,
+            tabulated.template Call<EosComponent::oneT, EosMode::ener>(ener_data));
+
+      auto pres_arr = std::array<Real, 5>{dens, 0., 0., expected(PRES())};
+      auto pres_data = EosData<EosComponent::oneT>(pres_arr);
+      check(pres_data,
+            tabulated.template Call<EosComponent::oneT, EosMode::pres>(pres_data));
+    }
+  }
+}
+
+// eos data with the mass fractions of a mixture, packed like a block that only has
+// the species in ids allocated
+struct MixtureData {
+  using Eos_t = GetEosTestData<EosVars<EosComponent::oneT>::types>::type;
+
+  Real &operator()(const material::MFRAC &var) { return mfrac[var.idx]; }
+  Real operator()(const material::MFRAC &var) const { return mfrac[var.idx]; }
+  template <typename T>
+  Real &operator()(const T &var) {
+    return eos(var);
+  }
+  std::size_t GetSize(const material::MFRAC &) const { return mfrac.size(); }
+  int SpeciesId(const int s) const { return ids[s]; }
+
+  Eos_t eos;
+  std::vector<Real> mfrac;
+  std::vector<int> ids{0, 1};
+};
+
+TEST(Eos, DaltonMixture) {
+  const std::vector<Real> gamma{1.4, 5. / 3.}, Abar{1., 4.}, Z{1., 2.};
+  auto mixture =
+      EquationOfState<EosModel::multitype>(material::SpeciesProperties(Z, Abar, gamma));
+  const Real dens = 2.;
+  const Real temp = 300.;
+
+  // a mixture of a single species is just that species
+  for (int s = 0; s < 2; s++) {
+    auto expected_arr = std::array<Real, 5>{dens, temp};
+    auto expected = EosData<EosComponent::oneT>(expected_arr);
+    EquationOfState<EosModel::gamma>(gamma[s], Abar[s])
+        .template Call<EosComponent::oneT, EosMode::temp>(expected);
+
+    MixtureData data{EosData<EosComponent::oneT>(expected_arr), {0., 0.}};
+    data.mfrac[s] = 1.;
+    mixture.template Call<EosComponent::oneT, EosMode::temp>(data);
+    EXPECT_NEAR(data(EINT()), expected(EINT()), 1.e-14 * expected(EINT()));
+    EXPECT_NEAR(data(PRES()), expected(PRES()), 1.e-14 * expected(PRES()));
+    EXPECT_NEAR(data(BMOD()), expected(BMOD()), 1.e-14 * expected(BMOD()));
+  }
+
+  // partial pressures & energies add at a common temperature
+  const std::vector<Real> mfrac{0.25, 0.75};
+  Real eint = 0., pres = 0.;
+  for (int s = 0; s < 2; s++) {
+    auto arr = std::array<Real, 5>{mfrac[s] * dens, temp};
+    auto partial = EosData<EosComponent::oneT>(arr);
+    EquationOfState<EosModel::gamma>(gamma[s], Abar[s])
+        .template Call<EosComponent::oneT, EosMode::temp>(partial);
+    eint += mfrac[s] * partial(EINT());
+    pres += partial(PRES());
+  }
+
+  auto arr = std::array<Real, 5>{dens, 0., eint};
+  MixtureData ener{EosData<EosComponent::oneT>(arr), mfrac};
+  mixture.template Call<EosComponent::oneT, EosMode::ener>(ener);
+  EXPECT_NEAR(ener(TEMP()), temp, 1.e-12 * temp);
+  EXPECT_NEAR(ener(PRES()), pres, 1.e-12 * pres);
+
+  arr = std::array<Real, 5>{dens, 0., 0., pres};
+  MixtureData pres_data{EosData<EosComponent::oneT>(arr), mfrac};
+  mixture.template Call<EosComponent::oneT, EosMode::pres>(pres_data);
+  EXPECT_NEAR(pres_data(TEMP()), temp, 1.e-12 * temp);
+  EXPECT_NEAR(pres_data(EINT()), eint, 1.e-12 * eint);
+}
+
+TEST(Eos, DaltonMixtureMissingSpecies) {
+  const std::vector<Real> gamma{1.4, 5. / 3., 1.2}, Abar{1., 4., 12.}, Z{1., 2., 6.};
+  auto mixture =
+      EquationOfState<EosModel::multitype>(material::SpeciesProperties(Z, Abar, gamma));
+  // the same mixture without the first species
+  auto reduced = EquationOfState<EosModel::multitype>(material::SpeciesProperties(
+      {Z[1], Z[2]}, {Abar[1], Abar[2]}, {gamma[1], gamma[2]}));
+  const Real dens = 2.;
+  const Real temp = 300.;
+  const std::vector<Real> mfrac{0.25, 0.75};
+
+  auto expected_arr = std::array<Real, 5>{dens, temp};
+  MixtureData expected{EosData<EosComponent::oneT>(expected_arr), mfrac};
+  reduced.template Call<EosComponent::oneT, EosMode::temp>(expected);
+
+  // species 0 isn't allocated, so the packed mass fractions belong to species 1 & 2
+  auto arr = std::array<Real, 5>{dens, temp};
+  MixtureData data{EosData<EosComponent::oneT>(arr), mfrac, {1, 2}};
+  mixture.template Call<EosComponent::oneT, EosMode::temp>(data);
+  EXPECT_NEAR(data(EINT()), expected(EINT()), 1.e-14 * expected(EINT()));
+  EXPECT_NEAR(data(PRES()), expected(PRES()), 1.e-14 * expected(PRES()));
+  EXPECT_NEAR(data(BMOD()), expected(BMOD()), 1.e-14 * expected(BMOD()));
+}
+
+TEST(Eos, ThreeT) {
+  using Data_t = GetEosTestData<EosVariables<Fluid::threeT>>::type;
+  constexpr Real gamma_ion = 5. / 3., gamma_ele = 1.4;
+  auto ion = EquationOfState<EosModel::gamma>(gamma_ion, 2.);
+  auto ele = ElectronEos(gamma_ele, 1.);
+  const Real cv_ion = GammaLawCv(gamma_ion, 2.);
+  const Real cv_ele = GammaLawCv(gamma_ele, 1.);
+  const Real dens = 3.;
+  const Real temp = 500.;
+
+  // both components at the cell temperature
+  Data_t data(Data_t::Arr_t{});
+  data(DENS()) = dens;
+  data(TEMP()) = temp;
+  ThreeTCall<EosMode::temp_equi>(ion, ele, data);
+  const Real eint = (cv_ion + cv_ele) * temp;
+  const Real pres = dens * ((gamma_ion - 1.) * cv_ion + (gamma_ele - 1.) * cv_ele) * temp;
+  EXPECT_EQ(data(TION()), temp);
+  EXPECT_EQ(data(TELE()), temp);
+  EXPECT_NEAR(data(EINT()), eint, 1.e-14 * eint);
+  EXPECT_NEAR(data(PRES()), pres, 1.e-14 * pres);
+  EXPECT_NEAR(data(BMOD()), gamma_ion * data(PION()) + gamma_ele * data(PELE()),
+              1.e-14 * data(BMOD()));
+
+  // equilibrium temperature from the total energy
+  Data_t ener(Data_t::Arr_t{});
+  ener(DENS()) = dens;
+  ener(EINT()) = eint;
+  ThreeTCall<EosMode::ener>(ion, ele, ener);
+  EXPECT_NEAR(ener(TEMP()), temp, 1.e-12 * temp);
+  EXPECT_NEAR(ener(TELE()), temp, 1.e-12 * temp);
+  EXPECT_NEAR(ener(PRES()), pres, 1.e-12 * pres);
+
+  // out of equilibrium components gathered into the totals
+  data(EION()) = 2. * cv_ion * temp;
+  data(EELE()) = 0.5 * cv_ele * temp;
+  ThreeTCall<EosMode::ei_gather>(ion, ele, data);
+  EXPECT_NEAR(data(TION()), 2. * temp, 1.e-12 * temp);
+  EXPECT_NEAR(data(TELE()), 0.5 * temp, 1.e-12 * temp);
+  EXPECT_NEAR(data(EINT()), data(EION()) + data(EELE()), 1.e-14 * data(EINT()));
+  EXPECT_NEAR(data(PRES()), data(PION()) + data(PELE()), 1.e-14 * data(PRES()));
+
+  // scatter a new total energy keeping the ratio of the components
+  const Real ratio = data(EION()) / data(EELE());
+  data(EINT()) *= 3.;
+  const Real new_eint = data(EINT());
+  ThreeTCall<EosMode::ei_scatter>(ion, ele, data);
+  EXPECT_NEAR(data(EION()) / data(EELE()), ratio, 1.e-14 * ratio);
+  EXPECT_NEAR(data(EINT()), new_eint, 1.e-14 * new_eint);
+  EXPECT_NEAR(data(TION()), 6. * temp, 1.e-12 * temp);
+}
+
 }  // namespace kamayan::eos
@@ -8,6 +8,7 @@
 #include "driver/kamayan_driver_types.hpp"
 #include "grid/grid.hpp"
 #include "grid/grid_types.hpp"
+#include "interface/update.hpp"
 #include "kamayan/fields.hpp"
 #include "kamayan/unit.hpp"
 #include "kamayan_utils/parallel.hpp"
@@ -16,6 +17,8 @@
 #include "physics/material_properties/eos/eos.hpp"
 #include "physics/material_properties/eos/equation_of_state.hpp"
 #include "physics/material_properties/material_types.hpp"
+#include "physics/material_properties/species_properties.hpp"
+#include "physics/physics_types.hpp"
 #include "utils/error_checking.hpp"
 
 namespace kamayan::material {
@@ -26,6 +29,7 @@ std::shared_ptr<KamayanUnit> ProcessUnit() {
   mspec->PostMeshInitialization.Register(PostMeshInitialization, {}, {"eos"});
   mspec->PrepareConserved = PrepareConserved;
   mspec->PreparePrimitive.Register(PreparePrimitive, {}, {"eos"});
+  mspec->AddTasksSplit = AddTasksSplit;
   return mspec;
 }
 
@@ -39,6 +43,17 @@ void SetupParams(KamayanUnit *unit) {
                          "Mass fraction deallocation threshold per species.");
   material.AddParm<Real>("default_mass_fraction", 0.0,
                          "default value for mass fractions on allocation");
+  PARTHENON_REQUIRE_THROWS(material.Get<Real>("deallocation_threshold") <
+                               material.Get<Real>("allocation_threshold"),
+                           "material/deallocation_threshold must be below "
+                           "material/allocation_threshold");
+
+  // <parthenon/sparse>
+  auto &parthenon_sparse = unit->AddData("parthenon/sparse");
+  parthenon_sparse.AddParm<int>(
+      "dealloc_count", 5,
+      "Number of consecutive cycles a species has to stay below its deallocation "
+      "threshold on a block before it is deallocated there.");
 
   auto species = strings::split(material.Get<std::string>("species"), ',');
   auto unique_species = std::set(species.begin(), species.end());
@@ -46,9 +61,11 @@ void SetupParams(KamayanUnit *unit) {
                            "material/species must be unique")
   unit->AddParam("species", species);
   unit->AddParam("nspecies", species.size());
+  // kernels dispatch on this to compile out the mass scalars
+  unit->Configuration()->Add(species.size() > 1 ? Species::multi : Species::single);
 
-  // placeholder to make sure we have the single species defined
-  // until a multispecies eos is added
+  // problems read their single species parameters from here, so make sure it is
+  // always defined
   if (std::find(species.begin(), species.end(), "single") == species.end()) {
     species.push_back("single");
   }
@@ -88,25 +105,37 @@ void InitializeData(KamayanUnit *unit) {
   auto species = strings::split(material.Get<std::string>("species"), ',');
   std::size_t nspecies = species.size();
 
-  eos::EOS_t eos;
+  // device copies of the species properties for mixture kernels
+  unit->AddParam("species_properties", MakeSpeciesProperties(species, unit));
+
+  auto eos = eos::MakeEos(species, unit);
+  unit->AddParam("eos", eos);
+  if (unit->Configuration()->Get<Fluid>() == Fluid::threeT) {
+    unit->AddParam("eos_ele", eos::MakeEosElectrons(species[0], unit));
+  }
+  // eos kernels dispatch on the model to skip visiting the variant
+  unit->Configuration()->Add(eos.Model());
+
   if (nspecies > 1) {
-    // build the multi species eos
-    // placeholder until we have a multispecies eos
-    eos = eos::MakeEosSingleSpecies("single", unit);
+    InitializeSparseFields(species, unit);
   } else {
-    eos = eos::MakeEosSingleSpecies(species[0], unit);
+    // there are no mass fractions to update, so don't schedule any tasks for them
+    unit->PostMeshInitialization = nullptr;
+    unit->PrepareConserved = nullptr;
+    unit->PreparePrimitive = nullptr;
+    unit->AddTasksSplit = nullptr;
   }
-  unit->AddParam("eos", eos);
+}
 
-  if (nspecies > 1) InitializeSparseFields(species, unit);
+TaskID AddTasksSplit(TaskID prev, TaskList &tl, MeshData *md, const Real &dt) {
+  // species that have left a block are dropped from its packs, so the flux kernels
+  // only carry the species actually present on each partition
+  return tl.AddTask(prev, "SparseDealloc", parthenon::Update::SparseDealloc, md);
 }
 
+// these are only registered with multiple species
 TaskStatus PostMeshInitialization(MeshData *md) {
   // make sure our mass fractions sum to 1
-  auto material = md->GetMeshPointer()->packages.Get("material");
-  const auto nspecies = material->Param<std::size_t>("nspecies");
-  if (nspecies == 1) return TaskStatus::complete;
-
   auto pack = grid::GetPack<MFRAC>(md);
 
   const int nblocks = pack.GetNBlocks();
@@ -130,10 +159,6 @@ TaskStatus PostMeshInitialization(MeshData *md) {
 }
 
 TaskStatus PrepareConserved(MeshData *md) {
-  auto material = md->GetMeshPointer()->packages.Get("material");
-  const auto nspecies = material->Param<std::size_t>("nspecies");
-  if (nspecies == 1) return TaskStatus::complete;
-
   auto pack = grid::GetPack<MFRAC, DENS>(md);
 
   const int nblocks = pack.GetNBlocks();
@@ -155,10 +180,6 @@ TaskStatus PrepareConserved(MeshData *md) {
 }
 
 TaskStatus PreparePrimitive(MeshData *md) {
-  auto material = md->GetMeshPointer()->packages.Get("material");
-  const auto nspecies = material->Param<std::size_t>("nspecies");
-  if (nspecies == 1) return TaskStatus::complete;
-
   auto pack = grid::GetPack<MFRAC, DENS>(md);
 
   const int nblocks = pack.GetNBlocks();
@@ -2,8 +2,11 @@
 #define PHYSICS_MATERIAL_PROPERTIES_MATERIAL_HPP_
 #include <memory>
 
+#include <Kokkos_Core.hpp>
+
 #include "driver/kamayan_driver_types.hpp"
 #include "kamayan/unit.hpp"
+#include "physics/material_properties/material_types.hpp"
 namespace kamayan::material {
 std::shared_ptr<KamayanUnit> ProcessUnit();
 void SetupParams(KamayanUnit *unit);
@@ -13,6 +16,21 @@ TaskStatus PostMeshInitialization(MeshData *md);
 
 TaskStatus PrepareConserved(MeshData *md);
 TaskStatus PreparePrimitive(MeshData *md);
+// deallocate the mass fractions that have stayed below their threshold
+TaskID AddTasksSplit(TaskID prev, TaskList &tl, MeshData *md, const Real &dt);
+
+// mass fractions of a single cell from the partial densities
+template <typename Pack>
+KOKKOS_INLINE_FUNCTION void PreparePrimitiveCell(const Pack &pack, const int b,
+                                                 const int k, const int j, const int i) {
+  Real dens = 0.0;
+  for (int s = 0; s <= pack.GetUpperBound(b, MFRAC()); s++) {
+    dens += pack(b, MFRAC(s), k, j, i);
+  }
+  for (int s = 0; s <= pack.GetUpperBound(b, MFRAC()); s++) {
+    pack(b, MFRAC(s), k, j, i) *= 1.0 / dens;
+  }
+}
 }  // namespace kamayan::material
 
 #endif  // PHYSICS_MATERIAL_PROPERTIES_MATERIAL_HPP_
@@ -1,9 +1,24 @@
 #ifndef PHYSICS_MATERIAL_PROPERTIES_MATERIAL_TYPES_HPP_
 #define PHYSICS_MATERIAL_PROPERTIES_MATERIAL_TYPES_HPP_
 
+#include "dispatcher/options.hpp"
 #include "kamayan/fields.hpp"
 
 namespace kamayan {
+// TODO(acreyes) : some kind of physical constants...
+// probably should be a struct with static constexpr...
+inline constexpr Real kboltz = 1.380649e-16;
+
+// same heat capacity singularity's IdealGas would use (gamma * Kt / abar)
+KOKKOS_INLINE_FUNCTION Real GammaLawCv(const Real gamma, const Real Abar) {
+  return gamma * kboltz / Abar;
+}
+
+// single species runs never allocate mass fractions, so the mass scalar paths can
+// be compiled out of the kernels that dispatch on this
+POLYMORPHIC_PARM(Species, single, multi);
+
+using SpeciesOptions = OptList<Species, Species::single, Species::multi>;
 namespace material {
 using MFRAC = SparseBase<"mass_fraction">;
 }  // namespace material
@@ -0,0 +1,71 @@
+#include "physics/material_properties/species_properties.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utils/error_checking.hpp"
+
+namespace kamayan::material {
+
+SpeciesProperties::SpeciesProperties(const std::vector<Real> &Z,
+                                     const std::vector<Real> &Abar,
+                                     const std::vector<Real> &gamma) {
+  PARTHENON_REQUIRE_THROWS(Abar.size() == Z.size() && gamma.size() == Z.size(),
+                           "Need every property for each species");
+  const int nspecies = Z.size();
+
+  Kokkos::View<Real **> data("species_properties", nprops, nspecies);
+  auto data_h = Kokkos::create_mirror_view(data);
+  for (int s = 0; s < nspecies; s++) {
+    data_h(Prop::Z, s) = Z[s];
+    data_h(Prop::Abar, s) = Abar[s];
+    data_h(Prop::gamma, s) = gamma[s];
+  }
+  Kokkos::deep_copy(data, data_h);
+  data_ = data;
+}
+
+SpeciesProperties MakeSpeciesProperties(const std::vector<std::string> &species,
+                                        KamayanUnit *material) {
+  std::vector<Real> Z, Abar, gamma;
+  for (const auto &spec : species) {
+    auto get_block = [&](const std::string &key) {
+      return "material/" + spec + "/" + key;
+    };  // NOLINT(readability/braces)
+    Z.push_back(material->Param<Real>(get_block("Z")));
+    Abar.push_back(material->Param<Real>(get_block("Abar")));
+    gamma.push_back(material->Param<Real>(get_block("gamma")));
+  }
+  return SpeciesProperties(Z, Abar, gamma);
+}
+
+namespace {
+SpeciesIds MakeSpeciesIds(const std::vector<MeshBlock *> &blocks) {
+  const int nblocks = blocks.size();
+  const int nspecies =
+      blocks[0]->packages.Get("material")->Param<std::size_t>("nspecies");
+  Kokkos::View<int **> ids("species_ids", nblocks, nspecies);
+  auto ids_h = Kokkos::create_mirror_view(ids);
+  for (int b = 0; b < nblocks; b++) {
+    // packs hold the allocated species in order of their sparse ids
+    int s = 0;
+    for (int id = 0; id < nspecies; id++) {
+      if (blocks[b]->IsAllocated(MFRAC::name(), id)) ids_h(b, s++) = id;
+    }
+  }
+  Kokkos::deep_copy(ids, ids_h);
+  return SpeciesIds(ids);
+}
+}  // namespace
+
+SpeciesIds MakeSpeciesIds(MeshData *md) {
+  std::vector<MeshBlock *> blocks;
+  for (int b = 0; b < md->NumBlocks(); b++) {
+    blocks.push_back(md->GetBlockData(b)->GetBlockPointer());
+  }
+  return MakeSpeciesIds(blocks);
+}
+
+SpeciesIds MakeSpeciesIds(MeshBlock *mb) { return MakeSpeciesIds(std::vector{mb}); }
+}  // namespace kamayan::material
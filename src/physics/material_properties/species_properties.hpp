@@ -0,0 +1,105 @@
+#ifndef PHYSICS_MATERIAL_PROPERTIES_SPECIES_PROPERTIES_HPP_
+#define PHYSICS_MATERIAL_PROPERTIES_SPECIES_PROPERTIES_HPP_
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "grid/grid_types.hpp"
+#include "kamayan/unit.hpp"
+#include "kamayan_utils/robust.hpp"
+#include "physics/material_properties/material_types.hpp"
+
+namespace kamayan::material {
+
+// properties of a mixture found from the mass fractions of a cell
+struct MixtureProperties {
+  Real Abar;   // mean atomic mass
+  Real Zbar;   // mean charge per ion
+  Real gamma;  // effective ratio of specific heats, as the Dalton eos mixes them
+  Real cv;     // heat capacity per unit mass, with GammaLawCv for each species
+};
+
+// per species properties in device memory, with each property stored
+// contiguously over the species & indexed by the sparse id of the MFRAC field.
+// The material/<species> parameters are only on the host, so kernels should go
+// through these instead
+class SpeciesProperties {
+ public:
+  enum Prop { Z = 0, Abar = 1, gamma = 2 };
+  static constexpr int nprops = 3;
+
+  SpeciesProperties() = default;
+  SpeciesProperties(const std::vector<Real> &Z, const std::vector<Real> &Abar,
+                    const std::vector<Real> &gamma);
+
+  KOKKOS_INLINE_FUNCTION int size() const { return data_.extent_int(1); }
+
+  KOKKOS_INLINE_FUNCTION Real operator()(const Prop prop, const int s) const {
+    return data_(prop, s);
+  }
+
+  // mixture of the species with the mass fractions in the indexer, which only holds
+  // the species allocated on its block and their ids, see SpeciesIndexer
+  template <typename Indexer>
+  KOKKOS_INLINE_FUNCTION MixtureProperties Mixture(const Indexer &indexer) const {
+    // moles per unit mass, charge per unit mass & heat capacities over kboltz
+    Real ni = 0.0, ne = 0.0, cv = 0.0, gm1_cv = 0.0;
+    const int nspecies = indexer.GetSize(MFRAC());
+    for (int s = 0; s < nspecies; s++) {
+      const int id = indexer.SpeciesId(s);
+      const Real x_abar = indexer(MFRAC(s)) / data_(Abar, id);
+      ni += x_abar;
+      ne += x_abar * data_(Z, id);
+      cv += x_abar * data_(gamma, id);
+      gm1_cv += x_abar * data_(gamma, id) * (data_(gamma, id) - 1.0);
+    }
+    return {utils::Ratio(1.0, ni), utils::Ratio(ne, ni), 1.0 + utils::Ratio(gm1_cv, cv),
+            kboltz * cv};
+  }
+
+ private:
+  Kokkos::View<const Real **, Kokkos::MemoryTraits<Kokkos::RandomAccess>> data_;
+};
+
+// gather the properties of each species from their material/<species> blocks
+SpeciesProperties MakeSpeciesProperties(const std::vector<std::string> &species,
+                                        KamayanUnit *material);
+
+// sparse ids of the species allocated on each block, in the order their mass fractions
+// are packed. A pack only holds the allocated species, which can be missing from a
+// block, so per species data must be looked up through these rather than pack indices
+class SpeciesIds {
+ public:
+  SpeciesIds() = default;
+  explicit SpeciesIds(Kokkos::View<const int **> ids) : ids_(ids) {}
+
+  // sparse id of the s'th packed mass fraction on block b
+  KOKKOS_INLINE_FUNCTION int operator()(const int b, const int s) const {
+    return ids_(b, s);
+  }
+
+ private:
+  Kokkos::View<const int **> ids_;
+};
+
+SpeciesIds MakeSpeciesIds(MeshData *md);
+SpeciesIds MakeSpeciesIds(MeshBlock *mb);
+
+// cell indexer that also knows which species its packed mass fractions belong to
+template <typename Indexer>
+struct SpeciesIndexer : Indexer {
+  KOKKOS_INLINE_FUNCTION SpeciesIndexer(const Indexer &indexer, const SpeciesIds &ids,
+                                        const int b)
+      : Indexer(indexer), ids_(ids), b_(b) {}
+
+  KOKKOS_INLINE_FUNCTION int SpeciesId(const int s) const { return ids_(b_, s); }
+
+ private:
+  SpeciesIds ids_;
+  int b_;
+};
+
+}  // namespace kamayan::material
+
+#endif  // PHYSICS_MATERIAL_PROPERTIES_SPECIES_PROPERTIES_HPP_
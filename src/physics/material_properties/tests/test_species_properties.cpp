@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "grid/geometry_types.hpp"
+#include "grid/grid.hpp"
+#include "grid/grid_types.hpp"
+#include "grid/subpack.hpp"
+#include "grid/tests/test_grid.hpp"
+#include "kamayan/config.hpp"
+#include "kamayan/fields.hpp"
+#include "kamayan/runtime_parameters.hpp"
+#include "kamayan/unit.hpp"
+#include "kokkos_abstraction.hpp"
+#include "physics/material_properties/material_types.hpp"
+#include "physics/material_properties/species_properties.hpp"
+
+namespace kamayan::material {
+
+// mass fractions of a single cell, packed like a block that only has the species in
+// ids allocated
+struct MassFractions {
+  Real operator()(const MFRAC &var) const { return mfrac[var.idx]; }
+  std::size_t GetSize(const MFRAC &) const { return mfrac.size(); }
+  int SpeciesId(const int s) const { return ids[s]; }
+
+  std::vector<Real> mfrac;
+  std::vector<int> ids{0, 1};
+};
+
+TEST(Material, SpeciesProperties) {
+  const std::vector<Real> Z{1., 2.}, Abar{1., 4.}, gamma{1.4, 5. / 3.};
+  auto props = SpeciesProperties(Z, Abar, gamma);
+  EXPECT_EQ(props.size(), 2);
+
+  // a mixture of a single species is just that species
+  for (int s = 0; s < 2; s++) {
+    MassFractions x{{0., 0.}};
+    x.mfrac[s] = 1.;
+    const auto mix = props.Mixture(x);
+    EXPECT_DOUBLE_EQ(mix.Abar, Abar[s]);
+    EXPECT_DOUBLE_EQ(mix.Zbar, Z[s]);
+    EXPECT_NEAR(mix.gamma, gamma[s], 1.e-14);
+  }
+
+  // equal moles of hydrogen & helium
+  const auto mix = props.Mixture(MassFractions{{0.2, 0.8}});
+  EXPECT_NEAR(mix.Abar, 2.5, 1.e-14);
+  EXPECT_NEAR(mix.Zbar, 1.5, 1.e-14);
+  // heat capacities go as gamma / Abar like the multi species eos
+  const Real cv = 0.2 * 1.4 + 0.2 * 5. / 3.;
+  const Real gm1_cv = 0.2 * 1.4 * 0.4 + 0.2 * 5. / 3. * 2. / 3.;
+  EXPECT_NEAR(mix.gamma, 1. + gm1_cv / cv, 1.e-14);
+  EXPECT_NEAR(mix.cv, kboltz * cv, 1.e-14 * kboltz * cv);
+}
+
+TEST(Material, SpeciesPropertiesMissingSpecies) {
+  const std::vector<Real> Z{1., 2., 6.}, Abar{1., 4., 12.}, gamma{1.4, 5. / 3., 1.2};
+  auto props = SpeciesProperties(Z, Abar, gamma);
+
+  // a block without hydrogen only packs the helium & carbon mass fractions
+  const auto mix = props.Mixture(MassFractions{{0.25, 0.75}, {1, 2}});
+  const Real ni = 0.25 / 4. + 0.75 / 12.;
+  EXPECT_NEAR(mix.Abar, 1. / ni, 1.e-14);
+  EXPECT_NEAR(mix.Zbar, (0.25 * 2. / 4. + 0.75 * 6. / 12.) / ni, 1.e-14);
+  const Real cv = 0.25 * 5. / 3. / 4. + 0.75 * 1.2 / 12.;
+  const Real gm1_cv = 0.25 * 5. / 3. * 2. / 3. / 4. + 0.75 * 1.2 * 0.2 / 12.;
+  EXPECT_NEAR(mix.gamma, 1. + gm1_cv / cv, 1.e-14);
+  EXPECT_NEAR(mix.cv, kboltz * cv, 1.e-14 * kboltz * cv);
+}
+
+TEST(Material, SpeciesIdsDeallocated) {
+  constexpr int NBLOCKS = 2;
+  constexpr int NXB = 4;
+  constexpr int NDIM = 2;
+  const std::vector<Real> Z{1., 2., 6.}, Abar{1., 4., 12.}, gamma{1.4, 5. / 3., 1.2};
+
+  auto pkg = std::make_shared<KamayanUnit>("material");
+  auto rps = std::make_shared<runtime_parameters::RuntimeParameters>();
+  auto cfg = std::make_shared<Config>();
+  cfg->Add(Geometry::cartesian);
+  pkg->InitResources(rps, cfg);
+  pkg->UnlockParams();
+  pkg->AddParam("nspecies", std::size_t(3));
+  Metadata meta_data({CENTER_FLAGS(Metadata::Independent, Metadata::Sparse)},
+                     MFRAC::Shape());
+  pkg->AddSparsePool<MFRAC>(meta_data, {0, 1, 2});
+
+  // labels of the sparse fields are <base name>_<sparse id>
+  const auto label = [](const int id) {
+    return MFRAC::name() + "_" + std::to_string(id);
+  };  // NOLINT(readability/braces)
+  auto block_list = MakeTestBlockList(pkg, NBLOCKS, NXB, NDIM);
+  for (auto &pmb : block_list) {
+    pmb->packages.Add(pkg);
+    for (int id = 0; id < 3; id++) {
+      pmb->meshblock_data.Get()->AllocateSparse(label(id));
+    }
+  }
+  // the lowest id species has left the second block
+  block_list[1]->meshblock_data.Get()->DeallocateSparse(label(0));
+  auto md = MakeTestMeshData(block_list);
+
+  const auto ids = MakeSpeciesIds(&md);
+  const auto props = SpeciesProperties(Z, Abar, gamma);
+  auto pack = grid::GetPack<MFRAC>(pkg.get(), &md);
+  const auto ib = md.GetBoundsI(IndexDomain::interior);
+  const auto jb = md.GetBoundsJ(IndexDomain::interior);
+  const auto kb = md.GetBoundsK(IndexDomain::interior);
+
+  // equal parts of every species packed on each block
+  Kokkos::View<Real *> abar("abar", NBLOCKS), mix_gamma("gamma", NBLOCKS);
+  parthenon::par_for(
+      PARTHENON_AUTO_LABEL, 0, NBLOCKS - 1, KOKKOS_LAMBDA(const int b) {
+        const int nspecies = pack.GetSize(b, MFRAC());
+        for (int s = 0; s < nspecies; s++) {
+          pack(b, MFRAC(s), kb.s, jb.s, ib.s) = 1.0 / nspecies;
+        }
+        const auto indexer = SpeciesIndexer(SubPack(pack, b, kb.s, jb.s, ib.s), ids, b);
+        const auto mix = props.Mixture(indexer);
+        abar(b) = mix.Abar;
+        mix_gamma(b) = mix.gamma;
+      });
+  auto abar_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), abar);
+  auto gamma_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), mix_gamma);
+
+  EXPECT_NEAR(abar_h(0), 3. / (1. + 1. / 4. + 1. / 12.), 1.e-14);
+  // only helium & carbon are left on the second block
+  EXPECT_NEAR(abar_h(1), 2. / (1. / 4. + 1. / 12.), 1.e-14);
+  const Real cv = 5. / 3. / 4. + 1.2 / 12.;
+  const Real gm1_cv = 5. / 3. * 2. / 3. / 4. + 1.2 * 0.2 / 12.;
+  EXPECT_NEAR(gamma_h(1), 1. + gm1_cv / cv, 1.e-14);
+}
+}  // namespace kamayan::material
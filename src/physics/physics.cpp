@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "kamayan/runtime_parameters.hpp"
 #include "kamayan/unit.hpp"
@@ -12,6 +13,7 @@ namespace kamayan::physics {
 std::shared_ptr<KamayanUnit> ProcessUnit() {
   auto physics = std::make_shared<KamayanUnit>("physics");
   physics->SetupParams.Register(SetupParams);
+  physics->InitializeData.Register(InitializeData);
   return physics;
 }
 
@@ -21,5 +23,23 @@ void SetupParams(KamayanUnit *unit) {
                          {{"1t", Fluid::oneT}, {"3t", Fluid::threeT}});
 
   physics.AddParm<Mhd>("MHD", "off", "Mhd model", {{"off", Mhd::off}, {"ct", Mhd::ct}});
+
+  physics.AddParm<bool>("fuse_prepare_primitive", false,
+                        "Recover the hydro, material & eos primitives in a single pass "
+                        "over the mesh instead of one per unit.");
+}
+
+void InitializeData(KamayanUnit *unit) {
+  auto cfg = unit->Configuration();
+  if (!unit->Data("physics").Get<bool>("fuse_prepare_primitive")) return;
+  PARTHENON_REQUIRE_THROWS(cfg->Get<Fluid>() == Fluid::oneT,
+                           "physics/fuse_prepare_primitive requires a 1T fluid.");
+
+  // the fused callback runs the units' per cell operations in the same order their
+  // own PreparePrimitive callbacks would have
+  auto order = unit->GetUnits()->FuseCallbacks(
+      [](KamayanUnit *u) -> auto & { return u->PreparePrimitive; }, "physics",
+      {"hydro", "material", "eos"}, FusedPreparePrimitive, "PreparePrimitive");
+  unit->AddParam("prepare_primitive_order", order);
 }
 }  // namespace kamayan::physics
@@ -2,6 +2,7 @@
 #define PHYSICS_PHYSICS_HPP_
 #include <memory>
 
+#include "driver/kamayan_driver_types.hpp"
 #include "kamayan/unit.hpp"
 #include "kamayan/unit_data.hpp"
 namespace kamayan::physics {
@@ -11,6 +12,11 @@ namespace kamayan::physics {
 // in addition to hydro
 std::shared_ptr<KamayanUnit> ProcessUnit();
 void SetupParams(KamayanUnit *unit);
+void InitializeData(KamayanUnit *unit);
+
+// single pass primitive recovery replacing the PreparePrimitive of hydro, material
+// & eos when physics/fuse_prepare_primitive is set
+TaskStatus FusedPreparePrimitive(MeshData *md);
 
 }  // namespace kamayan::physics
 
@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "dispatcher/dispatcher.hpp"
+#include "dispatcher/options.hpp"
+#include "driver/kamayan_driver_types.hpp"
+#include "grid/coordinates.hpp"
+#include "grid/geometry_types.hpp"
+#include "grid/grid.hpp"
+#include "grid/grid_types.hpp"
+#include "grid/subpack.hpp"
+#include "kamayan/config.hpp"
+#include "kamayan/fields.hpp"
+#include "kamayan_utils/type_abstractions.hpp"
+#include "kamayan_utils/type_list.hpp"
+#include "kokkos_abstraction.hpp"
+#include "physics/hydro/hydro_time_step.hpp"
+#include "physics/hydro/hydro_types.hpp"
+#include "physics/hydro/primconsflux.hpp"
+#include "physics/material_properties/eos/eos_types.hpp"
+#include "physics/material_properties/eos/equation_of_state.hpp"
+#include "physics/material_properties/material.hpp"
+#include "physics/material_properties/species_properties.hpp"
+#include "physics/physics.hpp"
+#include "physics/physics_types.hpp"
+
+namespace kamayan::physics {
+// per cell operations of the units fused into the primitive recovery
+enum class PrimitiveOp { hydro, material, eos };
+
+struct FusedPreparePrimitive_impl {
+  using options =
+      OptTypeList<hydro::HydroFactory, grid::GeometryOptions, eos::EosModelOptions>;
+  using value = TaskStatus;
+
+  template <typename hydro_traits, Geometry geom, EosModel model>
+  requires(NonTypeTemplateSpecialization<hydro_traits, hydro::HydroTraits>)
+  value dispatch(MeshData *md) {
+    auto &packages = md->GetMeshPointer()->packages;
+    // operations in the order the units' PreparePrimitive were registered
+    const auto &units = packages.Get("physics")->Param<std::vector<std::string>>(
+        "prepare_primitive_order");
+    Kokkos::Array<PrimitiveOp, 3> order;
+    int nops = 0;
+    for (const auto &unit : units) {
+      if (unit == "hydro") order[nops++] = PrimitiveOp::hydro;
+      if (unit == "material") order[nops++] = PrimitiveOp::material;
+      if (unit == "eos") order[nops++] = PrimitiveOp::eos;
+    }
+
+    using Fields = ConcatTypeLists_t<typename hydro_traits::ConsPrim, grid::CoordFields,
+                                     TypeList<CFAST>>;
+    auto pack = grid::GetPack(Fields(), md);
+    auto pack_mfrac = grid::GetPack<material::MFRAC>(md);
+    auto pack_eos = grid::GetPack(eos::EosPackVariables<Fluid::oneT>(), md);
+    auto eos = packages.Get("material")
+                   ->Param<eos::EOS_t>("eos")
+                   .template Get<eos::EquationOfState<model>>();
+    const auto species_ids = model == EosModel::multitype ? material::MakeSpeciesIds(md)
+                                                          : material::SpeciesIds();
+
+    auto eos_pkg = packages.Get("eos");
+    const bool memoize = eos_pkg->Param<bool>("memoize");
+    const Real memoize_tol = eos_pkg->Param<Real>("memoize_tolerance");
+    const bool cache_speeds =
+        md->GetMeshPointer()->resolved_packages->FieldPresent(CFAST::name());
+    const bool fuse_dt = hydro::FuseTimeStep(md);
+    Kokkos::View<Real> dt_min;
+    if (fuse_dt) {
+      dt_min = Kokkos::View<Real>("dt_min");
+      Kokkos::deep_copy(dt_min, std::numeric_limits<Real>::max());
+    }
+
+    const int nblocks = pack.GetNBlocks();
+    const int ndim = md->GetNDim();
+    auto ib = md->GetBoundsI(IndexDomain::interior);
+    auto jb = md->GetBoundsJ(IndexDomain::interior);
+    auto kb = md->GetBoundsK(IndexDomain::interior);
+
+    const int scratch_level = 0;
+    std::size_t scratch_size_in_bytes = eos::LambdaScratchSize(eos);
+
+    parthenon::par_for_outer(
+        PARTHENON_AUTO_LABEL, (ib.e - ib.s) * scratch_size_in_bytes, scratch_level, 0,
+        nblocks - 1, kb.s, kb.e, jb.s, jb.e,
+        KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int b, const int k,
+                      const int j) {
+          const auto coords = grid::CoordinatePack<geom, grid::CoordFields>(pack, b);
+          Real row_dt;
+          parthenon::par_reduce_inner(
+              parthenon::inner_loop_pattern_ttr_tag, member, ib.s, ib.e,
+              [&](const int i, Real &dt_local) {
+                for (int n = 0; n < nops; n++) {
+                  if (order[n] == PrimitiveOp::hydro) {
+                    hydro::PreparePrimitiveCell<hydro_traits, geom>(pack, coords, ndim,
+                                                                    b, k, j, i);
+                  } else if (order[n] == PrimitiveOp::material) {
+                    if constexpr (hydro_traits::SPECIES == Species::multi) {
+                      material::PreparePrimitiveCell(pack_mfrac, b, k, j, i);
+                    }
+                  } else {
+                    auto indexer = material::SpeciesIndexer(
+                        SubPack(pack_eos, b, k, j, i), species_ids, b);
+                    const bool hit =
+                        memoize && eos::MemoizedInputsMatch(indexer, memoize_tol);
+                    if (!hit) {
+                      eos::CallWithScratch<EosComponent::oneT, EosMode::ener>(
+                          eos, member, scratch_level, indexer);
+                    }
+                  }
+                }
+
+                auto V = SubPack(pack, b, k, j, i);
+                if (cache_speeds) hydro::CacheFastSpeed<hydro_traits::MHD>(V);
+                if (fuse_dt) {
+                  dt_local = Kokkos::min(
+                      dt_local, hydro::CellTimeStep<hydro_traits::MHD>(
+                                    V, coords, ndim, geom == Geometry::cylindrical,
+                                    cache_speeds, k, j, i));
+                }
+              },
+              Kokkos::Min<Real>(row_dt));
+          if (fuse_dt) Kokkos::atomic_min(&dt_min(), row_dt);
+        });
+
+    if (fuse_dt) {
+      Real dt;
+      Kokkos::deep_copy(dt, dt_min);
+      hydro::SetFusedTimeStep(md, dt);
+    }
+    return TaskStatus::complete;
+  }
+};
+
+TaskStatus FusedPreparePrimitive(MeshData *md) {
+  auto cfg = GetConfig(md);
+  return Dispatcher<FusedPreparePrimitive_impl>(PARTHENON_AUTO_LABEL, cfg.get())
+      .execute(md);
+}
+}  // namespace kamayan::physics
@@ -19,6 +19,7 @@ from kamayan.pyKamayan.Options import Mhd
 
 _PROBLEMS = Literal["sod", "briowu", "einfeldt"]
 _DIMENSION = Literal[1, 2]  # support work out in 3d
+_RIEMANN = Literal["hll", "hllc", "hlld"]
 
 mhd_problems: list[_PROBLEMS] = ["briowu"]
 
@@ -271,6 +272,7 @@ def shock_tube(
     aspect13: int = typer.Option(
         1, help="Aspect ratio to use for rotated shock tube. x3/x1"
     ),
+    riemann: _RIEMANN = typer.Option("hllc", help="Riemann solver to use."),
 ) -> KamayanManager:
     """Build KamayanManager for the shock tube problem."""
     mhd: physics.MHD = "ct" if problem in mhd_problems else "off"
@@ -309,6 +311,6 @@ def shock_tube(
     km.outputs.add("restarts", "rst", dt=0.01)
     gamma = 2.0 if problem == "briowu" else 1.4
     km.physics.eos = eos.GammaEos(gamma=gamma, mode_init="dens_pres")
-    km.physics.hydro = Hydro(reconstruction="wenoz", riemann="hllc")
+    km.physics.hydro = Hydro(reconstruction="wenoz", riemann=riemann)
     km.physics.mhd = mhd
     return km
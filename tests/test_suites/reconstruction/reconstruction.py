@@ -1,7 +1,7 @@
 """Reconstruction regression test."""
 
 # Modules
-from dataclasses import dataclass
+from dataclasses import dataclass, replace
 from pathlib import Path
 from typing import Literal
 
@@ -30,6 +30,9 @@ class ReconstructionConfig:
     geometry: _GEO = "cartesian"
     resolution: int = RES
     mhd: str = "off"
+    batch_mode: str = "scalar"
+    precision: str = "full"
+    cache_wave_speeds: bool = False
 
     @property
     def _cyl(self):
@@ -110,7 +113,13 @@ class ReconstructionConfig:
     def name(self) -> str:
         """Problem ID string for the simulation."""
         geo_suffix = f"_{self.geometry}_Mhd-{self.mhd}" if self._cyl else ""
-        return f"isentropic_vortex_{self.recon}_{self.slope_limiter}{geo_suffix}"
+        batch_suffix = f"_{self.batch_mode}" if self.batch_mode != "scalar" else ""
+        precision_suffix = f"_{self.precision}" if self.precision != "full" else ""
+        cache_suffix = "_cfast" if self.cache_wave_speeds else ""
+        return (
+            f"isentropic_vortex_{self.recon}_{self.slope_limiter}{geo_suffix}"
+            f"{batch_suffix}{precision_suffix}{cache_suffix}"
+        )
 
     @property
     def driver_input(self) -> str:
@@ -135,8 +144,17 @@ configs = [
     ReconstructionConfig("wenoz", max_error=0.005),
     ReconstructionConfig("wenoz", geometry="cylindrical", max_error=0.3),
     ReconstructionConfig("wenoz", geometry="cylindrical", mhd="ct", max_error=0.35),
+    ReconstructionConfig("wenoz", max_error=0.005, batch_mode="simd"),
+    ReconstructionConfig("wenoz", max_error=0.005, precision="mixed"),
+    ReconstructionConfig("wenoz", max_error=0.005, cache_wave_speeds=True),
 ]
 
+# relative difference allowed between the mixed & full precision errors
+MIXED_PRECISION_TOL = 1.0e-2
+# relative difference allowed between the errors with & without cached wave speeds,
+# which bound the riemann fan with cell centered speeds
+CACHED_SPEEDS_TOL = 5.0e-2
+
 
 class TestCase(utils.test_case.TestCaseAbs):
     """Test class for reconstruction."""
@@ -168,6 +186,9 @@ class TestCase(utils.test_case.TestCaseAbs):
             "parthenon/output0/file_type=hst",
             "parthenon/output0/dt=1.0",
             f"physics/MHD={config.mhd}",
+            f"hydro/batch_mode={config.batch_mode}",
+            f"hydro/flux_precision={config.precision}",
+            f"hydro/cache_wave_speeds={str(config.cache_wave_speeds).lower()}",
         ]
         if config._cyl:
             args.extend(
@@ -208,5 +229,17 @@ class TestCase(utils.test_case.TestCaseAbs):
             if error > config.max_error or np.isnan(error):
                 test_pass = False
                 msg += f"{name} -- error: {error} | max error: {config.max_error}\n"
+            if config.precision != "full":
+                full_name = replace(config, precision="full").name
+                _, full_error = errors[full_name]
+                if abs(error - full_error) > MIXED_PRECISION_TOL * full_error:
+                    test_pass = False
+                    msg += f"{name} -- error: {error} | full precision: {full_error}\n"
+            if config.cache_wave_speeds:
+                uncached_name = replace(config, cache_wave_speeds=False).name
+                _, uncached_error = errors[uncached_name]
+                if abs(error - uncached_error) > CACHED_SPEEDS_TOL * uncached_error:
+                    test_pass = False
+                    msg += f"{name} -- error: {error} | uncached: {uncached_error}\n"
         assert test_pass, msg
         return True
@@ -9,7 +9,7 @@ from typing import Optional
 import utils.test_case
 
 from kamayan.testing import baselines
-from parthenon_tools import phdf_diff
+from parthenon_tools import phdf, phdf_diff
 
 """ To prevent littering up imported folders with .pyc files or __pycache_ folder"""
 sys.dont_write_bytecode = True
@@ -30,6 +30,14 @@ class SedovConfig:
     numlevel: int = 1
     strategy: str = "scratchpad"
     species: Optional[str] = None
+    precision: str = "full"
+    fuse_timestep: bool = False
+    fuse_prepare_primitive: bool = False
+    memoize_eos: bool = False
+    tag_interval: int = 1
+    buffer: float = 0.0
+    # relative difference allowed in the number of blocks when the tagging changes
+    max_blocks_error: float = 0.0
 
 
 configs = [
@@ -38,6 +46,19 @@ configs = [
     SedovConfig(resolution=32, nxb=8, numlevel=3),
     SedovConfig(riemann="hllc", strategy="scratchvar"),
     SedovConfig(riemann="hll", species="one,two,three"),
+    SedovConfig(riemann="hllc", strategy="fused"),
+    SedovConfig(riemann="hllc", precision="mixed", max_error=1.0e-4),
+    SedovConfig(resolution=32, nxb=8, numlevel=3, fuse_timestep=True),
+    SedovConfig(riemann="hllc", fuse_prepare_primitive=True),
+    SedovConfig(riemann="hll", memoize_eos=True, max_error=1.0e-10),
+    SedovConfig(
+        resolution=32,
+        nxb=8,
+        numlevel=3,
+        tag_interval=2,
+        buffer=1.5,
+        max_blocks_error=0.2,
+    ),
 ]
 
 
@@ -51,6 +72,16 @@ class TestCase(utils.test_case.TestCaseAbs):
         )
         if config.species:
             name = f"{name}_multispecies"
+        if config.precision != "full":
+            name = f"{name}_{config.precision}"
+        if config.fuse_timestep:
+            name = f"{name}_fusedt"
+        if config.fuse_prepare_primitive:
+            name = f"{name}_fusedprim"
+        if config.memoize_eos:
+            name = f"{name}_memoeos"
+        if config.tag_interval != 1 or config.buffer > 0.0:
+            name = f"{name}_tag{config.tag_interval}_buf{config.buffer}"
         return name
 
     def Prepare(self, parameters, step):
@@ -72,6 +103,13 @@ class TestCase(utils.test_case.TestCaseAbs):
             f"parthenon/time/integrator={integrator}",
             f"hydro/riemann={config.riemann}",
             f"hydro/ReconstructionStrategy={config.strategy}",
+            f"hydro/flux_precision={config.precision}",
+            f"hydro/fuse_timestep={str(config.fuse_timestep).lower()}",
+            "physics/fuse_prepare_primitive="
+            f"{str(config.fuse_prepare_primitive).lower()}",
+            f"eos/memoize={str(config.memoize_eos).lower()}",
+            f"kamayan/refinement/tag_interval={config.tag_interval}",
+            f"kamayan/refinement/buffer={config.buffer}",
             "parthenon/output0/file_type=hdf5",
             "parthenon/output0/dt=1.0",
             "parthenon/output0/variables=dens,pres",
@@ -89,14 +127,32 @@ class TestCase(utils.test_case.TestCaseAbs):
         for config in configs:
             name = self._test_namer(config) + ".out0.final.phdf"
             output_file = output_dir / name
-            # hack to get scratchvar to compare against the scratchpad version
+            # hack to get scratchvar/fused to compare against the scratchpad version
+            # and mixed precision against the double precision one. The fused timestep
+            # should match the separate reduction, and so should the fused
+            # primitive recovery & the memoized eos. Tagging on an interval with a
+            # buffer only needs to refine about as much as tagging every cycle
+            retagged = config.tag_interval != 1 or config.buffer > 0.0
+            config.tag_interval = 1
+            config.buffer = 0.0
             config.strategy = "scratchpad"
+            config.precision = "full"
+            config.fuse_timestep = False
+            config.fuse_prepare_primitive = False
+            config.memoize_eos = False
             name = self._test_namer(config) + ".out0.final.phdf"
             baseline_file = baseline_dir / name
+            if retagged:
+                nblocks = phdf.phdf(str(output_file)).NumBlocks
+                nblocks_baseline = phdf.phdf(str(baseline_file)).NumBlocks
+                error = abs(nblocks - nblocks_baseline) / nblocks_baseline
+                print(f"{name}: {nblocks} blocks, baseline {nblocks_baseline}")
+                passing = passing and error <= config.max_blocks_error
+                continue
             delta = phdf_diff.compare(
                 [str(output_file), str(baseline_file)],
                 check_metadata=False,
-                tol=baselines.EPSILON,
+                tol=config.max_error,
                 relative=True,
             )
             passing = passing and delta == 0
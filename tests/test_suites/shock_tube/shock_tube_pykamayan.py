@@ -24,10 +24,19 @@ class ShockTubeConfig:
     ndim: int = 1
     aspect12: int = 2
     aspect13: int = 1
+    riemann: str = "hllc"
 
     @property
     def name(self) -> str:
         """Name the test."""
+        name = f"{self.problem}-NDIM{self.ndim}-a12_{self.aspect12}-a13_{self.aspect13}"
+        if self.riemann != "hllc":
+            name = f"{name}-{self.riemann}"
+        return name
+
+    @property
+    def baseline_name(self) -> str:
+        """Name of the run compared against, always using hllc."""
         return f"{self.problem}-NDIM{self.ndim}-a12_{self.aspect12}-a13_{self.aspect13}"
 
     @property
@@ -44,6 +53,7 @@ configs = [
     ShockTubeConfig(problem="briowu"),
     ShockTubeConfig(problem="einfeldt"),
     ShockTubeConfig(problem="briowu", ndim=2),
+    ShockTubeConfig(problem="briowu", riemann="hlld"),
 ]
 
 
@@ -58,6 +68,7 @@ class TestCase(PyKamayanTestCaseBase):
             f"--ndim={config.ndim}",
             f"--aspect12={config.aspect12}",
             f"--aspect13={config.aspect13}",
+            f"--riemann={config.riemann}",
             f"parthenon/job/problem_id={config.name}",
             "parthenon/output0/file_type=hdf5",
             "parthenon/output0/dt=0.05",
@@ -74,11 +85,19 @@ class TestCase(PyKamayanTestCaseBase):
         for config in configs:
             name = config.name + ".out0.final.phdf"
             output_file = output_dir / name
-            name = config.name + ".out0.final.phdf"
+            name = config.baseline_name + ".out0.final.phdf"
             baseline_file = baseline_dir / name
             tol = baselines.EPSILON * (50.0 if config.problem == "briowu" else 1.0)
+            relative = False
+            if config.riemann != "hllc":
+                # a different solver only needs to land close to the hllc solution
+                tol = 5.0e-2
+                relative = True
             delta = phdf_diff.compare(
-                [str(output_file), str(baseline_file)], check_metadata=False, tol=tol
+                [str(output_file), str(baseline_file)],
+                check_metadata=False,
+                tol=tol,
+                relative=relative,
             )
             passing = passing and delta == 0
 